@@ -1,12 +1,69 @@
 // 9cc.h
 
+#define _POSIX_C_SOURCE 200809L
+
 #include <ctype.h>
+#include <setjmp.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+// コンパイラの状態(compile.cの節を参照)
+typedef struct Context Context;
+
+// -------------
+// -- arena.c --
+// -------------
+
+typedef struct ArenaChunk ArenaChunk;
+
+// アリーナ
+// 小さな領域をチャンクから順に切り出し，まとめて解放する
+typedef struct {
+	ArenaChunk *head;	// チャンクの連結リスト
+	ArenaChunk *cur;	// 現在切り出しているチャンク
+	size_t used;		// 使用中のバイト数
+	size_t high_water;	// usedの最大値
+	size_t reserved;	// チャンクとして確保したバイト数
+} Arena;
+
+// 0で初期化されたsizeバイトの領域を確保する
+void *arena_alloc(Arena *a, size_t size);
+
+// 確保した領域をすべて解放済みとして扱う
+// チャンクは再利用のために残す
+void arena_reset(Arena *a);
+
+// チャンクをすべて解放する
+void arena_free(Arena *a);
+
+// ------------
+// -- emit.c --
+// ------------
+
+// メモリ上の出力先
+typedef struct {
+	char *data;
+	size_t len, cap;
+} OutBuf;
+
+// このスレッドの出力先をoutにする．NULLなら文脈の出力先(ctx->out)に戻す
+// 関数ごとのコードを別々のスレッドで作るのに使う．outに書いた分はemit_totalに数えない
+void emit_to(OutBuf *out);
+
+// printfと同様の書式で出力する
+// 対応する変換は%d, %ld, %s, %.*s, %%のみ
+void emit(char *fmt, ...);
+
+// 文字列，1文字，10進の整数を出力する
+void emit_strn(char *s, size_t len);
+void emit_char(char c);
+void emit_int(long val);
+
 // ----------------
 // -- tokenize.c --
 // ----------------
@@ -27,25 +84,22 @@ typedef enum {
 
 typedef struct Token Token;
 
+// トークンの長さの上限
+#define TOKEN_MAX_LEN (1 << 24)
+
 // Token型
-// 連結リストでトークン列を表現する
+// トークン列は配列tokensに連続して並べる
 struct Token {
-	TokenKind kind;
-	Token *next;
-	int val;	// TK_NUMの場合の数値
 	char *str;	// トークン文字列
-	int len; 	// トークンの長さ
+	int val;	// TK_NUMの場合の数値
+	unsigned kind : 8;	// TokenKind
+	unsigned len : 24;	// トークンの長さ
 };
 
-// 現在着目しているトークン
-// 特定の関数(consume, expect, expect_number)以外では触らない
-extern Token *token;
-
+// エラーを報告する
+// exitせず，メッセージを文脈に記録してこのスレッドのerror_jmpへ戻る
 void error(char *fmt, ...);
 
-// 入力
-extern char *user_input;
-
 // エラー箇所報告
 void error_at(char *loc, char *fmt, ...);
 
@@ -68,12 +122,12 @@ Token *consume_token(TokenKind kind);
 // 入力の終わりかどうかを調べる
 bool at_eof();
 
-// 新しいトークンを生成してcurに繋げる
-Token *new_token(TokenKind kind, Token *cur, char *str, int len);
+// 新しいトークンをctx->tokensの末尾に追加する
+Token *new_token(TokenKind kind, char *str, int len);
 
-// トークナイズする
-// headというダミーの要素を用いる，headの次の要素を返す
-void tokenize(char *p);
+// pからlenバイトをトークナイズする
+// 結果はctx->tokens[0..tokens_len)に格納され，末尾はTK_EOF
+void tokenize(char *p, size_t len);
 
 // -------------
 // -- parse.c --
@@ -99,55 +153,80 @@ typedef enum {
 	ND_BLOCK,
 	ND_FUNCALL,	// 関数呼び出し
 	ND_FUNC,	// 関数定義
-	ND_ARG,		// 関数の引数
 	ND_ADDR,	// 単項&
 	ND_DEREF,	// 単項*
+	NUM_NODE_KINDS,
 } NodeKind;
 
-typedef struct Node Node;
-
-struct Node {
-	NodeKind kind;
-	Node *lhs;
-	Node *rhs;
-	
-	Node *cond;	// 条件式
-	Node *inc;	// for文の第3引数
-	
-	Node *next;	// block,関数の引数で使用するリストの次の要素
-	
-	int val;	// ND_NUMのときに使用
-	int offset;	// ND_LVARのときに使用
-
-	char *name;
-	int len;
-
-	Node *args;	// 関数の引数
-	Node *body;	// 関数の本体
-};
-
-// 新しいノードを作成
-Node *new_node(NodeKind kind, Node *lhs, Node *rhs);
+// ASTのノードはノードプール上の32ビットの添字で参照する
+// 添字0は「ノードなし」を表す
+typedef uint32_t NodeId;
+
+// ノードプール(ctx->node_pool)
+// ノードは可変長で，先頭の1ワードの下位8ビットが種類，上位24ビットが
+// 子の個数(ND_BLOCK, ND_FUNCALL, ND_FUNCのみ)．続くワードが種類ごとのペイロード
+//   ND_NUM      val
+//   ND_LVAR     offset
+//   二項演算     lhs rhs (ND_ASSIGNを含む)
+//   ND_ADDR, ND_DEREF, ND_RETURN  lhs
+//   ND_IF       cond then els
+//   ND_WHILE    cond body (condが0なら無条件に繰り返す)
+//   ND_FOR      init cond inc body
+//   ND_BLOCK    stmt[count]
+//   ND_FUNCALL  name arg[count]
+//   ND_FUNC     name body param_offset[count]
+// nameは関数名のトークンのtokensにおける添字
+#define node_kind(n)	((NodeKind)(ctx->node_pool[n] & 0xff))
+#define node_count(n)	(ctx->node_pool[n] >> 8)
+
+#define NUM_VAL(n)		(*(int32_t *)&ctx->node_pool[(n) + 1])
+#define LVAR_OFFSET(n)	ctx->node_pool[(n) + 1]
+#define LHS(n)			ctx->node_pool[(n) + 1]
+#define RHS(n)			ctx->node_pool[(n) + 2]
+#define IF_COND(n)		ctx->node_pool[(n) + 1]
+#define IF_THEN(n)		ctx->node_pool[(n) + 2]
+#define IF_ELSE(n)		ctx->node_pool[(n) + 3]
+#define WHILE_COND(n)	ctx->node_pool[(n) + 1]
+#define WHILE_BODY(n)	ctx->node_pool[(n) + 2]
+#define FOR_INIT(n)		ctx->node_pool[(n) + 1]
+#define FOR_COND(n)		ctx->node_pool[(n) + 2]
+#define FOR_INC(n)		ctx->node_pool[(n) + 3]
+#define FOR_BODY(n)		ctx->node_pool[(n) + 4]
+#define BLOCK_STMT(n, i)	ctx->node_pool[(n) + 1 + (i)]
+#define CALL_NAME(n)	(&ctx->tokens[ctx->node_pool[(n) + 1]])
+#define CALL_ARG(n, i)	ctx->node_pool[(n) + 2 + (i)]
+#define FUNC_NAME(n)	(&ctx->tokens[ctx->node_pool[(n) + 1]])
+#define FUNC_BODY(n)	ctx->node_pool[(n) + 2]
+#define FUNC_PARAM(n, i)	ctx->node_pool[(n) + 3 + (i)]
+
+// 新しい二項演算のノードを作成
+NodeId new_node(NodeKind kind, NodeId lhs, NodeId rhs);
+
+// 新しい単項演算のノードを作成
+NodeId new_node_unary(NodeKind kind, NodeId lhs);
 
 // 新しい整数ノードを作成
-Node *new_node_num(int val);
+NodeId new_node_num(int val);
 
-// stmtを格納
-extern Node *code[];
+// 新しいローカル変数のノードを作成
+NodeId new_node_lvar(int offset);
+
+// 新しいブロックのノードを作成
+NodeId new_node_block(NodeId *stmts, int count);
 
 // EBNDで示された規則に対応する関数
 
 void program();
-Node *def();
-Node *stmt();
-Node *expr();
-Node *assign();
-Node *equality();
-Node *relational();
-Node *add();
-Node *mul();
-Node *primary();
-Node *unary();
+NodeId def();
+NodeId stmt();
+NodeId expr();
+NodeId assign();
+NodeId equality();
+NodeId relational();
+NodeId add();
+NodeId mul();
+NodeId primary();
+NodeId unary();
 
 // Local Variables
 typedef struct LVar LVar;
@@ -158,32 +237,586 @@ struct LVar {
 	char *name;
 	int len;
 	int offset;
-};
-
-// ローカル変数の連結リスト
-extern LVar *locals;
 
+	LVar *hash_next;	// 記号表の同じバケットの次の変数
+	uint32_t hash;		// 名前のハッシュ値
+	int depth;			// 宣言されたブロックの深さ
+};
 
 typedef struct Func Func;
+typedef struct IrFunc IrFunc;
+typedef struct ObjCall ObjCall;
+
+// インライン展開での関数の状態
+typedef enum {
+	INLINE_NONE,
+	INLINE_ACTIVE,	// 中間表現を作っている(呼び出すと再帰になる)
+	INLINE_DONE,
+} InlineState;
 
 struct Func {
-	Node *node;	// 関数ノード
+	NodeId node;	// 関数ノード
 	
 	Func *next; // 次の関数
 	LVar *locals;	// 関数のローカル変数
-};
 
-extern Func *functions;
+	uint32_t name;	// 関数名のトークンの添字
+	uint32_t tok_end;	// 定義の最後のトークンの次の添字(定義は名前の1つ前から始まる)
+	int nparams;	// 引数の個数
+
+	IrFunc *ir;		// 中間表現(インライン展開で作ったもの)
+	unsigned char inline_state;	// InlineState
+	uint64_t key;	// コードのキャッシュのキー(inline_irで作る)
+
+	int text_offset;	// -cでの.textの中の位置
+	int text_size;		// -cでの機械語の大きさ
+	ObjCall *calls;		// -cでの関数の中の呼び出し(.textに置くまで)
+	int ncalls;
+
+	Func *hash_next;	// 関数の表の同じバケットの次の関数
+	uint32_t hash;		// 名前のハッシュ値
+};
 
 // 名前で識別子を探す
+// 内側のスコープの変数が優先される
 LVar *find_lvar(Token *tok);
 
-// トークンを元に新たな変数を作成
+// トークンを元に現在のスコープに新たな変数を作成
 LVar *new_lvar(Token *tok);
 
+// ブロックのスコープに出入りする
+void enter_scope();
+void leave_scope();
+
+// 名前で関数定義を探す
+Func *find_func(Token *tok);
+
+// ------------
+// -- fold.c --
+// ------------
+
+// ASTの定数畳み込みと代数的な簡約を行う
+void fold();
+
+// ----------
+// -- ir.c --
+// ----------
+
+// 中間表現(SSA形式の3番地コード)の命令の種類
+typedef enum {
+	IR_IMM,		// 定数．どのブロックにも属さない
+	IR_UNDEF,	// 代入される前の変数の値
+	IR_PARAM,	// 引数．valは何番目か
+	IR_COPY,	// 変数への代入
+	IR_PHI,
+	IR_ADD,
+	IR_SUB,
+	IR_MUL,
+	IR_DIV,
+	IR_EQ,
+	IR_NE,
+	IR_LT,
+	IR_LE,
+	IR_ADDR,	// 変数のアドレス
+	IR_LOAD,	// アドレスの指す値
+	IR_LOADVAR,	// アドレスを取られた変数を読む
+	IR_STOREVAR,	// アドレスを取られた変数に書く
+	IR_CALL,	// valは関数名のトークンの添字
+	IR_JMP,
+	IR_BR,		// 0でなければsucc[0]，0ならsucc[1]へ
+	IR_RET,
+	NUM_IR_OPS,
+} IrOp;
+
+typedef struct IrInst IrInst;
+typedef struct IrBlock IrBlock;
+
+// 命令．命令が定義する値も兼ねる
+// varが0でない値は変数(番号var)のあるバージョンで，同じ変数の値は
+// すべてその変数のスタック上の領域に置く．phiの引数は必ず同じ変数の値になる
+struct IrInst {
+	unsigned char op;	// IrOp
+	int id;			// 値の番号
+	int var;		// 変数の番号(オフセット / 8)．一時的な値なら0
+	int64_t val;	// IR_IMM: 値 / IR_PARAM: 何番目か / IR_CALL: 関数名
+	int nargs;
+	IrInst **args;
+	IrInst *inline_args[2];	// 引数が2個までならここに置く
+
+	IrBlock *block;
+	IrInst *prev, *next;
+
+	IrInst *repl;	// 置き換え先(自明なphiの除去で使う)
+	int loc;		// 置き場所(コード生成で使う)
+	int mark;		// 各パスで自由に使う
+};
+
+// 基本ブロック
+// 末尾の命令(IR_JMP, IR_BR, IR_RET)で終わり，phiは先頭に並ぶ
+struct IrBlock {
+	int id;
+	IrInst *first, *last;
+	IrBlock **preds;	// phiの引数はこの順に並ぶ
+	int npreds, preds_cap;
+	IrBlock *succ[2];
+	IrBlock *next;		// 関数内の次のブロック
+	int mark;			// 各パスで自由に使う
+};
+
+struct IrFunc {
+	NodeId node;		// 関数ノード
+	IrBlock *blocks;	// 先頭が入口
+	int nvalues;		// 値の番号の上限
+	int nblocks;		// ブロックの番号の上限
+	int nvars;			// 変数の番号の上限(関数の末尾から抜けたときの値を含む)
+	LVar **vars;		// 変数の番号からローカル変数を引く
+};
+
+// 中間表現を確保するアリーナ．コード生成のスレッドはそれぞれ自分のものを使う
+extern _Thread_local Arena *ir_arena;
+
+// 関数ノードから中間表現を作る
+IrFunc *build_ir(NodeId node);
+
+// 定数の値を作る
+IrInst *ir_imm(IrFunc *fn, int64_t val);
+
+// 命令を作る．どのブロックにも属さない
+IrInst *ir_new_inst(IrFunc *fn, IrOp op, int nargs);
+
+// fnのブロックを作り，afterの次につなぐ
+IrBlock *ir_new_block(IrFunc *fn, IrBlock *after);
+
+// 命令をブロックの末尾に追加する
+void ir_append(IrBlock *block, IrInst *inst);
+
+// 前任ブロックを追加する
+void ir_add_pred(IrBlock *block, IrBlock *pred);
+
+// 命令をブロックから外す
+void ir_remove(IrInst *inst);
+
+// 入口から辿れないブロックを消す
+void remove_unreachable(IrFunc *fn);
+
+// 無条件ジャンプでつながったブロックをまとめる
+void merge_blocks(IrFunc *fn);
+
+// 引数がすべて同じ値のphiを消す
+void simplify_phis(IrFunc *fn);
+
+// 値が使われない命令を消す
+void dce(IrFunc *fn);
+
+// 中間表現を出力する
+void dump_ir(IrFunc *fn);
+
+// --------------
+// -- inline.c --
+// --------------
+
+// 関数の中間表現を作り，呼び出している小さな関数を展開する
+IrFunc *inline_ir(Func *func);
+
+// ----------------
+// -- tailcall.c --
+// ----------------
+
+// 自己再帰の末尾呼び出しをループにする
+void tail_recursion(IrFunc *fn);
+
+// ------------
+// -- sccp.c --
+// ------------
+
+// 疎な条件付き定数伝播
+void sccp(IrFunc *fn);
+
+// ------------
+// -- licm.c --
+// ------------
+
+// ループの中で値の変わらない式をループの前に移す
+void licm(IrFunc *fn);
+
+// -----------
+// -- asm.c --
+// -----------
+
+// x86-64の汎用レジスタ
+// 並びは機械語での番号に合わせる
+typedef enum {
+	REG_RAX, REG_RCX, REG_RDX, REG_RBX, REG_RSP, REG_RBP, REG_RSI, REG_RDI,
+	REG_R8, REG_R9, REG_R10, REG_R11, REG_R12, REG_R13, REG_R14, REG_R15,
+	NUM_X86_REGS,
+} Reg;
+
+// オペランドの種類
+typedef enum {
+	OPD_NONE,
+	OPD_REG,	// レジスタ
+	OPD_IMM,	// 即値
+	OPD_MEM,	// [reg+disp]
+	OPD_LABEL,	// 関数内のラベル
+	OPD_SYM,	// 関数名
+} OperandKind;
+
+// ラベルの種類
+typedef enum {
+	LBL_BLOCK,	// 基本ブロック
+} LabelKind;
+
+typedef struct {
+	unsigned char kind;	// OperandKind
+	unsigned char reg;	// OPD_REG, OPD_MEM: レジスタ / OPD_LABEL: LabelKind
+	unsigned char index;	// OPD_MEM: 添字のレジスタ
+	unsigned char scale;	// OPD_MEM: 添字の倍率(0なら添字なし)
+	int64_t val;	// OPD_IMM: 値 / OPD_MEM: 変位 / OPD_LABEL: 番号 / OPD_SYM: 名前のトークンの添字
+} Operand;
+
+// 命令の種類
+typedef enum {
+	OP_LABEL,	// ラベルの定義
+	OP_FUNC,	// 関数の入口(.globlとラベル)
+	OP_MOV,
+	OP_MOVZB,	// 8ビットのレジスタからゼロ拡張
+	OP_LEA,
+	OP_PUSH,
+	OP_POP,
+	OP_ADD,
+	OP_SUB,
+	OP_IMUL,	// srcがなければrdx:rax = rax * dst
+	OP_AND,
+	OP_NEG,
+	OP_SHL,
+	OP_SHR,
+	OP_SAR,
+	OP_CQO,
+	OP_IDIV,
+	OP_CMP,
+	OP_SETCC,	// 8ビットのレジスタに条件を書く
+	OP_JMP,		// dstが関数ならsrcは引数の個数(末尾呼び出し)
+	OP_JCC,
+	OP_CALL,	// srcは引数の個数
+	OP_RET,
+	NUM_OPS,
+} InstOp;
+
+// 条件(機械語での番号)
+typedef enum {
+	CC_E = 0x4,
+	CC_NE = 0x5,
+	CC_L = 0xc,
+	CC_GE = 0xd,
+	CC_LE = 0xe,
+	CC_G = 0xf,
+} CondCode;
+
+typedef struct {
+	unsigned char op;	// InstOp
+	unsigned char cc;	// OP_SETCC, OP_JCC: CondCode
+	Operand dst;
+	Operand src;
+} Inst;
+
+// 生成中の関数の命令列(スレッドごと)
+extern _Thread_local Inst *insts;
+extern _Thread_local int insts_len;
+
+Operand opd_reg(Reg reg);
+Operand opd_imm(int64_t val);
+Operand opd_mem(Reg base, int disp);
+Operand opd_mem_index(Reg base, Reg index, int scale, int disp);
+Operand opd_label(LabelKind kind, int num);
+Operand opd_sym(uint32_t tok);
+
+// 命令列の末尾に命令を追加する
+Inst *add_inst(InstOp op, Operand dst, Operand src);
+
+// 命令列をアセンブリ(-cなら機械語)として出力し，空にする
+void flush_insts();
+
+// ----------------
+// -- peephole.c --
+// ----------------
+
+// パターン
+enum {
+	PH_PUSH_POP,	// push X; pop Y => mov Y, X
+	PH_SELF_MOVE,	// mov X, X => 削除
+	PH_DEAD_MOVE,	// 値が使われないレジスタへのmov => 削除
+	PH_COPY,		// mov A, X; mov B, A => mov B, X (movzbも)
+	PH_IMM_OPERAND,	// mov A, imm; op B, A => op B, imm
+	PH_MEM_OPERAND,	// mov A, [m]; op B, A => op B, [m]
+	PH_COMMUTE,		// add A, B; mov B, A => add B, A
+	PH_ADDR_FOLD,	// lea A, [m]; mov B, [A] => mov B, [m]
+	NUM_PATTERNS,
+};
+
+// パターンごとの適用回数を標準エラー出力に表示する
+void print_peephole_stats(Context *c);
+
+// 命令列に覗き穴最適化を施す
+void peephole();
+
+// --------------
+// -- encode.c --
+// --------------
+
+// 関数呼び出し(と末尾呼び出しのジャンプ)
+struct ObjCall {
+	int offset;		// .textの中の変位(rel32)の位置
+	uint32_t name;	// 呼び出し先の名前のトークンの添字
+};
+
+// 生成中の関数の命令列を機械語にして出力する
+// 関数の位置と呼び出しの位置は関数の先頭からのものになる
+void encode_insts();
+
+// encode_instsで作った関数の機械語を.textの末尾に置き，位置を.textの中のものに直す
+void add_func_text(Func *func, char *buf, int len);
+
+// 呼び出し先が定義した関数なら変位を埋めて真を返す
+bool patch_call(ObjCall *call);
+
+// -----------
+// -- elf.c --
+// -----------
+
+// 定義した関数への呼び出しの変位を埋め，
+// .textと関数のシンボル，定義のない関数への再配置をELFのオブジェクトとして出力する
+void write_object();
+
+// -----------
+// -- jit.c --
+// -----------
+
+// compileした文脈の機械語を実行可能なメモリに置いてmainを呼び出し，その値を*resultに入れる
+// 定義のない関数はlibcのいくつかの関数に結びつける．エラーなら0以外を返す
+int jit_run(Context *c, int *result);
+
 // ---------------
 // -- codegen.c --
 // ---------------
 
 // nodeに対応するコードを生成
 void codegen();
+
+// -------------
+// -- cache.c --
+// -------------
+
+// 関数のコードのキャッシュ
+// キーは関数の定義のトークン列とオプションのハッシュ値に，展開した関数のキーを混ぜたもの
+// 展開しない呼び出しは呼び出し先によらず同じコードになるので，呼び出し先が変わっても使える
+
+// funcの定義のトークン列とオプションからキーを作る
+uint64_t cache_key(Func *func);
+
+// keyに展開した関数のキーを混ぜる
+uint64_t cache_key_add(uint64_t key, uint64_t callee);
+
+// keyのコードをctx->cache_dirから読んで出力する．なければ偽を返す
+bool cache_load(uint64_t key);
+
+// keyのコードをctx->cache_dirに書く．書けなければ何もしない
+void cache_store(uint64_t key, char *data, size_t len);
+
+// ------------
+// -- file.c --
+// ------------
+
+// コンパイルする入力
+typedef struct {
+	char *name;		// エラーの表示に使う名前．引数に書いたプログラムならNULL
+	char *data;
+	size_t len;
+	bool mapped;	// dataをmmapしたか
+} Input;
+
+// pathのファイルを読む．"-"なら標準入力を読む
+bool read_file(char *path, Input *in);
+
+// argがファイルならread_fileで読む．ファイルがなく，argが空白か{を含むならarg自体をプログラムとする
+bool open_input(char *arg, Input *in);
+
+void close_input(Input *in);
+
+// lenバイトをすべて書き出す
+bool write_all(int fd, char *p, size_t len);
+bool write_file(char *path, char *p, size_t len);
+
+// -------------
+// -- batch.c --
+// -------------
+
+// argsのファイル(@で始まるものは1行に1つのファイル名を並べた一覧)をnthreadsのスレッドで
+// コンパイルし，それぞれの拡張子を.s(-cなら.o)に替えたファイルに出力する
+// オプションはoptsのものを使う．かかった時間を標準エラー出力に表示し，失敗した入力の数を返す
+int compile_batch(Context *opts, char **args, int nargs, int nthreads);
+
+// -------------
+// -- stats.c --
+// -------------
+
+// コンパイルの段階
+typedef enum {
+	PHASE_TOKENIZE,
+	PHASE_PARSE,
+	PHASE_FOLD,
+	PHASE_IR,		// 中間表現を作ってインライン展開する
+	PHASE_CODEGEN,	// 関数ごとに最適化してコードを作る(スレッドで分け合う)
+	PHASE_OUTPUT,	// 関数のコードをつなぐ(-cならELFのオブジェクトにする)
+	NUM_PHASES,
+} Phase;
+
+// Chrome trace形式で書き出す区間
+typedef struct {
+	char *cat;		// 区間の分類
+	char *name;
+	int len;
+	int tid;		// 実行したスレッド．0はcompileを呼んだスレッド
+	double start, end;
+} Span;
+
+// startから始めた段階pの時間を足し，--traceなら区間を記録する．今の時刻を返す
+double end_phase(Phase p, double start);
+
+// 分類cat，lenバイトの名前nameの区間を記録する．名前は書き出すまで残しておく
+void add_span(char *cat, char *name, int len, int tid, double start, double end);
+
+// 統計を標準エラー出力に表示する
+void print_stats(Context *c);
+
+// 記録した区間をChrome trace形式のJSONでpathに書き出す
+bool write_trace(Context *c, char *path);
+
+// ---------------
+// -- compile.c --
+// ---------------
+
+// 定義より前に書かれた呼び出し
+// programの最後に引数の個数を検査する
+typedef struct {
+	uint32_t name;	// 関数名のトークンの添字
+	int nargs;
+} PendingCall;
+
+// コンパイラの状態
+// 入力ごとに1つ作ってcompileに渡す．別々の文脈なら複数のスレッドから同時にcompileしてよい
+struct Context {
+	// オプション
+	bool opt_dump_ir;		// 中間表現を出力する(--dump-ir)
+	bool opt_object;		// 機械語を出力する(-c)
+	bool opt_peephole;		// 覗き穴最適化
+	bool opt_sccp;			// 疎な条件付き定数伝播
+	bool opt_licm;			// ループ不変式の移動
+	bool opt_tailcall;		// 末尾呼び出しの最適化
+	bool opt_inline_report;	// 展開した関数を報告する
+	int inline_threshold;	// 展開する関数の命令数の上限．0なら展開しない
+	int codegen_threads;	// コードを生成するスレッドの数．0ならCPUの数だけ使う
+	_Atomic int *spare_threads;	// NULLでなければ，ここにある空いたスレッドもコード生成に借りる(--batch)
+	char *cache_dir;		// 関数のコードのキャッシュを置くディレクトリ(--cache)．NULLなら使わない
+
+	// 入力とトークン列(tokenize.c)
+	char *input_name;	// エラーの表示に使う入力の名前．NULLなら表示しない
+	char *user_input;
+	size_t input_len;
+	Token *tokens;
+	int tokens_len, tokens_cap;
+	int token_pos;		// 現在着目しているトークンの添字．consume, expectなど以外では触らない
+	int token_allocs;	// トークン配列の確保回数
+
+	// AST(parse.c)
+	uint32_t *node_pool;
+	int node_pool_len, node_pool_cap;
+	int node_count_total;	// 作成したノードの個数
+	int node_kinds[NUM_NODE_KINDS];	// 種類ごとに数えたノードの個数
+	NodeId *code;			// 関数定義．末尾は0
+	int code_len, code_cap;
+	Func *functions;
+
+	// パース中の状態(parse.c)
+	NodeId *child_stack;	// 子ノードを一時的に積んでおくスタック
+	int child_stack_len, child_stack_cap;
+	LVar **lvar_buckets;	// ローカル変数の記号表
+	int lvar_buckets_cap;
+	LVar **scope_vars;		// スコープ内で宣言された変数を宣言順に積んだスタック
+	int scope_vars_len, scope_vars_cap;
+	int scope_depth;		// 現在のブロックの深さ(関数の本体が1)
+	Func **func_buckets;	// 関数の表
+	int func_buckets_cap, func_count;
+	int lvar_count;			// 作成したローカル変数(引数を含む)
+	PendingCall *pending_calls;
+	int pending_calls_len, pending_calls_cap;
+
+	// Sethi-Ullmanの番号のキャッシュ(ir.c)
+	unsigned char *su_cache;
+	int su_cache_len;
+
+	// 統計．コード生成のスレッドからも数える
+	int fold_count;					// 畳み込んだノード
+	int inline_count;				// 展開した呼び出し
+	_Atomic int ir_blocks_total;	// 作成したブロック
+	_Atomic int ir_values_total;	// 作成した値
+	_Atomic int dce_removed;		// 不要な命令の除去で消した命令
+	_Atomic int tail_loops;			// ループにした自己再帰の末尾呼び出し
+	_Atomic int tail_jumps;			// ジャンプにした末尾呼び出し
+	_Atomic int sccp_consts;		// 定数に置き換えた引数
+	_Atomic int sccp_branches;		// 畳み込んだ分岐
+	_Atomic int licm_hoisted;		// ループの外へ移した命令
+	_Atomic int strength_reduced;	// シフトなどに置き換えた定数の乗除算
+	_Atomic long insts_total;		// 出力した命令
+	_Atomic int cache_hits;			// キャッシュから取り出した関数
+	_Atomic int cache_misses;		// キャッシュになく，コードを作った関数
+	_Atomic long pattern_hits[NUM_PATTERNS];	// 覗き穴最適化のパターンごとの適用回数
+	size_t codegen_bytes;			// コード生成のスレッドが確保したバイト数(中間表現とスレッドごとの出力)
+
+	// 計測(stats.c)
+	bool opt_trace;					// 区間を記録する(--trace)
+	double start_time;				// compileを始めた時刻
+	double phase_time[NUM_PHASES];	// 段階ごとにかかった時間(秒)
+	Span *spans;
+	int spans_len, spans_cap;
+
+	// 出力
+	OutBuf *out;
+	size_t emit_total;		// outに出力したバイト数
+	unsigned char *text;	// -cでの.textセクションの中身
+	int text_len, text_cap;
+	ObjCall *obj_calls;		// -cでの関数呼び出し(と末尾呼び出しのジャンプ)
+	int obj_calls_len, obj_calls_cap;
+
+	// コンパイル全体で使うアリーナ
+	Arena arena;
+
+	// 最初のエラーのメッセージ
+	_Atomic bool failed;
+	char *error_msg;
+};
+
+// このスレッドで処理中の文脈
+extern _Thread_local Context *ctx;
+
+// このスレッドのエラーの戻り先
+// error, error_atはメッセージを文脈に記録してここへlongjmpする
+extern _Thread_local jmp_buf *error_jmp;
+
+// 単調増加する時計の現在時刻(秒)
+double now();
+
+// 既定のオプションで文脈を作る
+Context *new_context();
+
+// srcのオプションをdstに写す
+void copy_options(Context *dst, Context *src);
+
+// 文脈とそれが持つものをすべて解放する
+void free_context(Context *c);
+
+// srcからlenバイトのプログラムをコンパイルし，アセンブリ(-cならELFのオブジェクト)をoutに出力する
+// outがNULLなら出力せず，機械語をjit_runで実行するために残すだけにする
+// 成功すれば0，エラーなら0以外を返す．メッセージはc->error_msgに残る
+// srcはNUL終端でなくてよいが，トークンが指すのでfree_contextまで残しておく
+// 1つの文脈でコンパイルするのは1度だけ
+int compile(Context *c, char *src, size_t len, OutBuf *out);
@@ -0,0 +1,95 @@
+// arena.c
+// バンプポインタ方式のアリーナアロケータ
+
+#include "9cc.h"
+
+// チャンクの標準サイズ
+#define ARENA_CHUNK_SIZE (64 * 1024)
+
+// 確保する領域のアラインメント
+#define ARENA_ALIGN 16
+
+struct ArenaChunk {
+	ArenaChunk *next;
+	size_t size;	// dataの大きさ
+	size_t used;	// dataのうち使用済みの大きさ
+	char data[];
+};
+
+// 新しいチャンクをcurの後ろに繋げる
+static ArenaChunk *new_chunk(Arena *a, size_t size) {
+	if (size < ARENA_CHUNK_SIZE) {
+		size = ARENA_CHUNK_SIZE;
+	}
+	ArenaChunk *chunk = malloc(sizeof(ArenaChunk) + size);
+	if (!chunk) {
+		error("メモリが足りません");
+	}
+	chunk->size = size;
+	chunk->used = 0;
+
+	if (a->cur) {
+		chunk->next = a->cur->next;
+		a->cur->next = chunk;
+	}
+	else {
+		chunk->next = a->head;
+		a->head = chunk;
+	}
+	a->reserved += size;
+	return chunk;
+}
+
+// 0で初期化されたsizeバイトの領域を確保する
+void *arena_alloc(Arena *a, size_t size) {
+	size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+
+	ArenaChunk *chunk = a->cur;
+	if (chunk && chunk->size - chunk->used < size) {
+		// リセット後は既存のチャンクを順に使い直す
+		ArenaChunk *next = chunk->next;
+		if (next && next->used == 0 && next->size >= size) {
+			chunk = next;
+		}
+		else {
+			chunk = NULL;
+		}
+	}
+	if (!chunk) {
+		chunk = new_chunk(a, size);
+	}
+	a->cur = chunk;
+
+	void *p = chunk->data + chunk->used;
+	chunk->used += size;
+
+	a->used += size;
+	if (a->used > a->high_water) {
+		a->high_water = a->used;
+	}
+	memset(p, 0, size);
+	return p;
+}
+
+// 確保した領域をすべて解放済みとして扱う
+// チャンクは手元に残し，次のコンパイルで再利用する
+void arena_reset(Arena *a) {
+	for (ArenaChunk *chunk = a->head; chunk; chunk = chunk->next) {
+		chunk->used = 0;
+	}
+	a->cur = a->head;
+	a->used = 0;
+}
+
+// チャンクをすべてOSに返す
+void arena_free(Arena *a) {
+	ArenaChunk *chunk = a->head;
+	while (chunk) {
+		ArenaChunk *next = chunk->next;
+		free(chunk);
+		chunk = next;
+	}
+	a->head = a->cur = NULL;
+	a->used = 0;
+	a->reserved = 0;
+}
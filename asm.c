@@ -0,0 +1,181 @@
+// asm.c
+// 命令列の組み立てとアセンブリの出力
+
+#include "9cc.h"
+
+// 生成中の関数の命令列(スレッドごと)
+_Thread_local Inst *insts;
+_Thread_local int insts_len;
+static _Thread_local int insts_cap;
+
+// 出力中の関数の名前．ブロックのラベルにつけて関数ごとに区別する
+static _Thread_local Token *func_name;
+
+static char *reg64[] = {
+	"rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi",
+	"r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15",
+};
+
+static char *reg8[] = {
+	"al", "cl", "dl", "bl", "spl", "bpl", "sil", "dil",
+	"r8b", "r9b", "r10b", "r11b", "r12b", "r13b", "r14b", "r15b",
+};
+
+static char *op_names[] = {
+	[OP_MOV] = "mov", [OP_MOVZB] = "movzb", [OP_LEA] = "lea",
+	[OP_PUSH] = "push", [OP_POP] = "pop", [OP_ADD] = "add", [OP_SUB] = "sub",
+	[OP_IMUL] = "imul", [OP_AND] = "and", [OP_NEG] = "neg", [OP_SHL] = "shl",
+	[OP_SHR] = "shr", [OP_SAR] = "sar", [OP_CQO] = "cqo", [OP_IDIV] = "idiv",
+	[OP_CMP] = "cmp", [OP_JMP] = "jmp", [OP_CALL] = "call", [OP_RET] = "ret",
+};
+
+static char *cc_names[16] = {
+	[CC_E] = "e", [CC_NE] = "ne", [CC_L] = "l", [CC_GE] = "ge",
+	[CC_LE] = "le", [CC_G] = "g",
+};
+
+static char *label_names[] = {
+	[LBL_BLOCK] = "bb",
+};
+
+Operand opd_reg(Reg reg) {
+	return (Operand){.kind = OPD_REG, .reg = reg};
+}
+
+Operand opd_imm(int64_t val) {
+	return (Operand){.kind = OPD_IMM, .val = val};
+}
+
+Operand opd_mem(Reg base, int disp) {
+	return (Operand){.kind = OPD_MEM, .reg = base, .val = disp};
+}
+
+// [base+index*scale+disp]
+Operand opd_mem_index(Reg base, Reg index, int scale, int disp) {
+	return (Operand){.kind = OPD_MEM, .reg = base, .index = index, .scale = scale, .val = disp};
+}
+
+Operand opd_label(LabelKind kind, int num) {
+	return (Operand){.kind = OPD_LABEL, .reg = kind, .val = num};
+}
+
+Operand opd_sym(uint32_t tok) {
+	return (Operand){.kind = OPD_SYM, .val = tok};
+}
+
+// 命令列の末尾に命令を追加する
+Inst *add_inst(InstOp op, Operand dst, Operand src) {
+	if (insts_len == insts_cap) {
+		insts_cap = insts_cap ? insts_cap * 2 : 1024;
+		insts = realloc(insts, sizeof(Inst) * insts_cap);
+		if (!insts) {
+			error("メモリが足りません");
+		}
+	}
+	Inst *inst = &insts[insts_len++];
+	inst->op = op;
+	inst->cc = 0;
+	inst->dst = dst;
+	inst->src = src;
+	return inst;
+}
+
+// オペランドを出力する
+// byteが真ならレジスタを8ビットの名前で出力する
+static void print_operand(Operand *opd, bool byte) {
+	Token *tok;
+
+	switch (opd->kind) {
+	case OPD_REG:
+		emit("%s", byte ? reg8[opd->reg] : reg64[opd->reg]);
+		return;
+	case OPD_IMM:
+		emit_int(opd->val);
+		return;
+	case OPD_MEM:
+		emit_char('[');
+		emit("%s", reg64[opd->reg]);
+		if (opd->scale) {
+			emit("+%s*%d", reg64[opd->index], opd->scale);
+		}
+		if (opd->val > 0) {
+			emit_char('+');
+		}
+		if (opd->val) {
+			emit_int(opd->val);
+		}
+		emit_char(']');
+		return;
+	case OPD_LABEL:
+		emit(".L%.*s.%s", func_name->len, func_name->str, label_names[opd->reg]);
+		emit_int(opd->val);
+		return;
+	case OPD_SYM:
+		tok = &ctx->tokens[opd->val];
+		emit_strn(tok->str, tok->len);
+		return;
+	}
+}
+
+static void print_inst(Inst *inst) {
+	switch (inst->op) {
+	case OP_LABEL:
+		print_operand(&inst->dst, false);
+		emit(":\n");
+		return;
+	case OP_FUNC:
+		func_name = &ctx->tokens[inst->dst.val];
+		emit(".globl ");
+		print_operand(&inst->dst, false);
+		emit_char('\n');
+		print_operand(&inst->dst, false);
+		emit(":\n");
+		return;
+	case OP_SETCC:
+		emit("    set%s ", cc_names[inst->cc]);
+		print_operand(&inst->dst, true);
+		emit_char('\n');
+		return;
+	case OP_JCC:
+		emit("    j%s ", cc_names[inst->cc]);
+		print_operand(&inst->dst, false);
+		emit_char('\n');
+		return;
+	case OP_CALL:
+	case OP_JMP:
+		// srcは引数の個数
+		emit("    %s ", op_names[inst->op]);
+		print_operand(&inst->dst, false);
+		emit_char('\n');
+		return;
+	}
+
+	emit("    %s", op_names[inst->op]);
+	if (inst->dst.kind != OPD_NONE) {
+		emit_char(' ');
+		// 即値を書き込むときなどはメモリの大きさを明示する
+		if (inst->dst.kind == OPD_MEM && (inst->src.kind == OPD_IMM || inst->src.kind == OPD_NONE)) {
+			emit("QWORD PTR ");
+		}
+		print_operand(&inst->dst, false);
+	}
+	if (inst->src.kind != OPD_NONE) {
+		emit(", ");
+		print_operand(&inst->src, inst->op == OP_MOVZB);
+	}
+	emit_char('\n');
+}
+
+// 命令列をアセンブリ(-cなら機械語)として出力し，空にする
+void flush_insts() {
+	if (ctx->opt_object) {
+		encode_insts();
+	}
+	else {
+		for (int i = 0; i < insts_len; i++) {
+			print_inst(&insts[i]);
+		}
+	}
+	ctx->insts_total += insts_len;
+	insts_len = 0;
+}
@@ -0,0 +1,328 @@
+// batch.c
+// 複数のファイルを1つのプロセスでコンパイルする(--batch)
+
+#include "9cc.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// 1つの入力ファイル
+typedef struct {
+	char *path;
+	size_t size;		// ファイルの大きさ．仕事の量の目安にする
+	size_t out_len;
+	double time;		// コンパイルにかかった時間(秒)
+	bool failed;
+} Job;
+
+// スレッドごとの仕事の列
+// 入力は大きい順に並んでいて，持ち主も盗む側も先頭の大きいものから取る
+typedef struct {
+	pthread_mutex_t lock;
+	int *jobs;					// Jobの添字
+	int head, tail;
+	_Atomic size_t remaining;	// 残っている仕事の量
+} Deque;
+
+typedef struct {
+	Context *opts;
+	Job *jobs;
+	Deque *deques;
+	int nthreads;
+	_Atomic int spare;	// 仕事のないスレッドの数．その分だけ他のファイルのコード生成が使う
+	_Atomic int steals;	// 他のスレッドの列から取った回数
+} Pool;
+
+typedef struct {
+	Pool *pool;
+	int id;
+	pthread_t thread;
+} BatchWorker;
+
+// 仕事の量．空のファイルも数えるように1を足す
+static size_t weight(Job *job) {
+	return job->size + 1;
+}
+
+// dの先頭の仕事を取る．なければ-1
+static int take(Pool *pool, Deque *d) {
+	int j = -1;
+	pthread_mutex_lock(&d->lock);
+	if (d->head < d->tail) {
+		j = d->jobs[d->head++];
+		d->remaining -= weight(&pool->jobs[j]);
+	}
+	pthread_mutex_unlock(&d->lock);
+	return j;
+}
+
+// 自分の列が空なら，残りの最も多いスレッドから盗む
+// すべての列が空なら-1
+static int next_job(Pool *pool, int id) {
+	int j = take(pool, &pool->deques[id]);
+	while (j < 0) {
+		Deque *victim = NULL;
+		size_t most = 0;
+		for (int i = 0; i < pool->nthreads; i++) {
+			size_t r = pool->deques[i].remaining;
+			if (r > most) {
+				most = r;
+				victim = &pool->deques[i];
+			}
+		}
+		if (!victim) {
+			return -1;
+		}
+		j = take(pool, victim);
+		if (j >= 0 && victim != &pool->deques[id]) {
+			pool->steals++;
+		}
+	}
+	return j;
+}
+
+// 入力の拡張子を出力の拡張子に替える
+static char *output_path(Context *opts, char *path) {
+	char *ext = opts->opt_dump_ir ? ".ir" : opts->opt_object ? ".o" : ".s";
+	size_t len = strlen(path);
+	if (len > 2 && !strcmp(path + len - 2, ".c")) {
+		len -= 2;
+	}
+	char *out = malloc(len + strlen(ext) + 1);
+	if (out) {
+		memcpy(out, path, len);
+		strcpy(out + len, ext);
+	}
+	return out;
+}
+
+static void compile_job(Pool *pool, Job *job) {
+	double start = now();
+	Input in;
+	if (!read_file(job->path, &in)) {
+		fprintf(stderr, "%sを読めません\n", job->path);
+		job->failed = true;
+		return;
+	}
+
+	Context *c = new_context();
+	char *path = output_path(pool->opts, job->path);
+	OutBuf out = {0};
+	if (!c || !path) {
+		fprintf(stderr, "メモリが足りません\n");
+		job->failed = true;
+	}
+	else {
+		// ファイルの間で並列に動かすので，コード生成は空いたスレッドがあるときだけ分ける
+		copy_options(c, pool->opts);
+		c->input_name = in.name;
+		c->codegen_threads = 1;
+		c->spare_threads = &pool->spare;
+		if (compile(c, in.data, in.len, &out)) {
+			fprintf(stderr, "%s\n", c->error_msg ? c->error_msg : "メモリが足りません");
+			job->failed = true;
+		}
+		else if (!write_file(path, out.data, out.len)) {
+			fprintf(stderr, "%sに書き出せません\n", path);
+			job->failed = true;
+		}
+	}
+	job->out_len = out.len;
+	free(out.data);
+	free(path);
+	free_context(c);
+	close_input(&in);
+	job->time = now() - start;
+}
+
+static void *run_jobs(void *arg) {
+	BatchWorker *w = arg;
+	for (int j; (j = next_job(w->pool, w->id)) >= 0;) {
+		compile_job(w->pool, &w->pool->jobs[j]);
+	}
+	// 仕事がなくなったので，このスレッドの分をまだ動いているファイルに貸す
+	w->pool->spare++;
+	return NULL;
+}
+
+// 入力ファイルの名前の一覧
+typedef struct {
+	char **paths;
+	int len, cap;
+} PathList;
+
+static bool add_path(PathList *list, char *path) {
+	if (list->len == list->cap) {
+		list->cap = list->cap ? list->cap * 2 : 64;
+		char **paths = realloc(list->paths, sizeof(char *) * list->cap);
+		if (!paths) {
+			return false;
+		}
+		list->paths = paths;
+	}
+	list->paths[list->len++] = path;
+	return true;
+}
+
+// 1行に1つのファイル名を並べた一覧を読む．空行は飛ばす
+// 名前は一覧の中身を写した*bufの中を指す
+static bool read_manifest(PathList *list, char *path, char **buf) {
+	Input in;
+	if (!read_file(path, &in)) {
+		fprintf(stderr, "%sを読めません\n", path);
+		return false;
+	}
+	*buf = malloc(in.len + 1);
+	if (!*buf) {
+		close_input(&in);
+		fprintf(stderr, "メモリが足りません\n");
+		return false;
+	}
+	memcpy(*buf, in.data, in.len);
+	(*buf)[in.len] = '\n';
+	close_input(&in);
+
+	char *end = *buf + in.len + 1;
+	for (char *p = *buf; p < end;) {
+		char *nl = memchr(p, '\n', end - p);
+		char *q = nl;
+		while (q > p && (q[-1] == '\r' || q[-1] == ' ' || q[-1] == '\t')) {
+			q--;
+		}
+		*q = '\0';
+		if (q > p && !add_path(list, p)) {
+			fprintf(stderr, "メモリが足りません\n");
+			return false;
+		}
+		p = nl + 1;
+	}
+	return true;
+}
+
+// 大きい順に並べる
+static int by_size(const void *a, const void *b) {
+	size_t x = ((Job *)a)->size, y = ((Job *)b)->size;
+	return x < y ? 1 : x > y ? -1 : 0;
+}
+
+int compile_batch(Context *opts, char **args, int nargs, int nthreads) {
+	PathList list = {0};
+	char **bufs = calloc(nargs, sizeof(char *));
+	if (!bufs) {
+		fprintf(stderr, "メモリが足りません\n");
+		return nargs;
+	}
+	for (int i = 0; i < nargs; i++) {
+		bool ok = args[i][0] == '@' ? read_manifest(&list, args[i] + 1, &bufs[i]) : add_path(&list, args[i]);
+		if (!ok) {
+			for (int k = 0; k <= i; k++) {
+				free(bufs[k]);
+			}
+			free(bufs);
+			free(list.paths);
+			return nargs;
+		}
+	}
+
+	// スレッドはファイルの数まで使い，残りはコード生成に貸す
+	int njobs = list.len;
+	if (nthreads <= 0) {
+		nthreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	}
+	int budget = nthreads;
+	if (nthreads > njobs) {
+		nthreads = njobs;
+	}
+	if (nthreads < 1) {
+		nthreads = 1;
+	}
+
+	Pool pool = {.opts = opts, .nthreads = nthreads, .spare = budget > nthreads ? budget - nthreads : 0};
+	pool.jobs = calloc(njobs + 1, sizeof(Job));
+	pool.deques = calloc(nthreads, sizeof(Deque));
+	BatchWorker *workers = calloc(nthreads, sizeof(BatchWorker));
+	int *slots = calloc(njobs + 1, sizeof(int));
+	if (!pool.jobs || !pool.deques || !workers || !slots) {
+		fprintf(stderr, "メモリが足りません\n");
+		return njobs ? njobs : 1;
+	}
+
+	// 大きいものから順に各スレッドの列へ配る
+	size_t total_in = 0;
+	for (int i = 0; i < njobs; i++) {
+		Job *job = &pool.jobs[i];
+		job->path = list.paths[i];
+		struct stat st;
+		if (strcmp(job->path, "-") && !stat(job->path, &st)) {
+			job->size = st.st_size;
+		}
+		total_in += job->size;
+	}
+	qsort(pool.jobs, njobs, sizeof(Job), by_size);
+	int per = (njobs + nthreads - 1) / nthreads;
+	for (int t = 0; t < nthreads; t++) {
+		Deque *d = &pool.deques[t];
+		pthread_mutex_init(&d->lock, NULL);
+		d->jobs = slots + t * per;
+	}
+	for (int i = 0; i < njobs; i++) {
+		Deque *d = &pool.deques[i % nthreads];
+		d->jobs[d->tail++] = i;
+		d->remaining += weight(&pool.jobs[i]);
+	}
+
+	// このスレッドも1つ目のスレッドとして働く
+	// スレッドを作れなければ，作れた分だけで進める．残った列は他のスレッドが盗む
+	double start = now();
+	int started = 1;
+	for (; started < nthreads; started++) {
+		workers[started] = (BatchWorker){.pool = &pool, .id = started};
+		if (pthread_create(&workers[started].thread, NULL, run_jobs, &workers[started])) {
+			break;
+		}
+	}
+	workers[0] = (BatchWorker){.pool = &pool, .id = 0};
+	run_jobs(&workers[0]);
+	for (int i = 1; i < started; i++) {
+		pthread_join(workers[i].thread, NULL);
+	}
+	double wall = now() - start;
+
+	int failed = 0;
+	size_t total_out = 0;
+	double busy = 0;
+	Job *slowest = NULL;
+	for (int i = 0; i < njobs; i++) {
+		Job *job = &pool.jobs[i];
+		failed += job->failed;
+		total_out += job->out_len;
+		busy += job->time;
+		if (!slowest || job->time > slowest->time) {
+			slowest = job;
+		}
+	}
+	fprintf(stderr, "batch: %d files, %d failed, %d threads, %d steals\n",
+			njobs, failed, started, pool.steals);
+	fprintf(stderr, "batch: %zu bytes in, %zu bytes out\n", total_in, total_out);
+	fprintf(stderr, "batch: %.3f ms wall, %.3f ms in files (%.1f MB/s)\n",
+			wall * 1e3, busy * 1e3, wall > 0 ? total_in / wall / 1e6 : 0.0);
+	if (slowest) {
+		fprintf(stderr, "batch: slowest %s in %.3f ms\n", slowest->path, slowest->time * 1e3);
+	}
+
+	for (int t = 0; t < nthreads; t++) {
+		pthread_mutex_destroy(&pool.deques[t].lock);
+	}
+	for (int i = 0; i < nargs; i++) {
+		free(bufs[i]);
+	}
+	free(bufs);
+	free(list.paths);
+	free(pool.jobs);
+	free(pool.deques);
+	free(workers);
+	free(slots);
+	return failed;
+}
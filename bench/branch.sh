@@ -0,0 +1,52 @@
+#!/bin/bash
+# 条件分岐の多いループについて，1回あたりの実行命令数と実行時間を測る
+# 使い方: bench/branch.sh [外側の繰り返し回数] [9ccのパス] [比べる9ccのパス]
+#
+# 実行命令数はbench/icount.cで1命令ずつ数え，外側のループを1回と2回にした
+# ものの差を内側のループの回数で割って求める
+
+n="${1:-200000}"
+cc9="${2:-./9cc}"
+base="$3"
+dir="$(dirname "$0")"
+tmp="$(mktemp -d)"
+trap 'rm -rf "$tmp"' EXIT
+
+inner=1000
+cc -O2 -o "$tmp/icount" "$dir/icount.c" || exit 1
+
+prog() {
+    echo "int main() {int i; int j; int s; s = 0;
+        for (i = 0; i < $1; i = i + 1)
+            for (j = 0; j < $inner; j = j + 1)
+                if (j < i) s = s + 1; else if (j == i) s = s + 2;
+        return s;}"
+}
+
+build() {
+    "$1" "$(prog "$2")" > "$tmp/a.s" || exit 1
+    cc -static -o "$tmp/a" "$tmp/a.s" 2> /dev/null || exit 1
+}
+
+run() {
+    name="$1"
+    cc="$2"
+
+    build "$cc" 1
+    c1=$("$tmp/icount" "$tmp/a")
+    build "$cc" 2
+    c2=$("$tmp/icount" "$tmp/a")
+
+    build "$cc" "$n"
+    start=$(date +%s%N)
+    "$tmp/a"
+    status=$?
+    end=$(date +%s%N)
+    echo "$name: $(( (c2 - c1) / inner )) instructions/iteration," \
+        "$(( (end - start) / 1000000 )) ms (exit $status)"
+}
+
+run current "$cc9"
+if [ -n "$base" ]; then
+    run base "$base"
+fi
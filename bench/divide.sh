@@ -0,0 +1,29 @@
+#!/bin/bash
+# 定数による乗除算の実行時間を，同じ計算をidiv, imulでしたものと比べる
+# 使い方: bench/divide.sh [繰り返し回数] [9ccのパス]
+#
+# 割る数をメモリから読むと定数と分からないので，idiv, imulのままになる
+
+n="${1:-50000000}"
+cc9="${2:-./9cc}"
+tmp="$(mktemp -d)"
+trap 'rm -rf "$tmp"' EXIT
+
+run() {
+    name="$1"
+    src="$2"
+
+    "$cc9" "$src" > "$tmp/$name.s" || exit 1
+    cc -static -o "$tmp/$name" "$tmp/$name.s" 2> /dev/null || exit 1
+    start=$(date +%s%N)
+    "$tmp/$name"
+    status=$?
+    end=$(date +%s%N)
+    echo "$name: $(( (end - start) / 1000000 )) ms (exit $status)"
+}
+
+body="int i; int s; s = 0; for (i = 0; i < $n; i = i + 1) s = s + i / D7 + i / D16 - i * D10;"
+
+run const "int main() {${body//D/} return s;}"
+run variable "int main() {int k7; int k16; int k10; int p7; int p16; int p10;
+    k7 = 7; k16 = 16; k10 = 10; p7 = &k7; p16 = &k16; p10 = &k10; ${body//D/*p} return s;}"
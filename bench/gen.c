@@ -0,0 +1,202 @@
+// gen.c
+// コンパイルの速さを測るために，9ccで扱える文法の大きなプログラムを作る
+// 使い方: gen 種類 バイト数 [シード]
+//
+// 種類は次のとおり．mixはほかの種類の関数を順に並べる
+//   funcs   小さな関数をたくさん並べ，前の関数を呼び出す
+//   expr    とても長い式
+//   nest    深く入れ子になったif, while, for
+//   locals  ローカル変数の多い関数
+//   loops   本体の長いループ
+// 関数はすべてint fN(int a, int b)の形で，最後にf0を呼び出すmainを置く
+// 同じ種類，大きさ，シードなら同じプログラムになる
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static long written;
+static unsigned long seed = 1;
+
+static void out(char *fmt, ...) {
+	va_list ap;
+	va_start(ap, fmt);
+	written += vprintf(fmt, ap);
+	va_end(ap);
+}
+
+// 0以上n未満の擬似乱数
+static int rnd(int n) {
+	seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+	return (seed >> 33) % n;
+}
+
+static char *binops[] = {"+", "-", "*", "+", "-"};
+static char *cmpops[] = {"<", "<=", ">", ">=", "==", "!="};
+
+// 変数と定数からなる式．depthが残っていれば括弧でくくった部分式も使う
+static void expr(int terms, int depth, int nvars) {
+	for (int i = 0; i < terms; i++) {
+		if (i) {
+			out(" %s ", binops[rnd(5)]);
+		}
+		int r = rnd(8);
+		if (depth > 0 && r == 0) {
+			out("(");
+			expr(2 + rnd(4), depth - 1, nvars);
+			out(")");
+		}
+		else if (r < 4 && nvars) {
+			out("v%d", rnd(nvars));
+		}
+		else if (r < 6) {
+			out("%c", "ab"[rnd(2)]);
+		}
+		else {
+			out("%d", rnd(100));
+		}
+	}
+}
+
+static void cond(int nvars) {
+	out("%c %s ", "ab"[rnd(2)], cmpops[rnd(6)]);
+	expr(1 + rnd(2), 0, nvars);
+}
+
+// 使う変数v0からv(n-1)を宣言する
+static void decls(int n) {
+	for (int i = 0; i < n; i++) {
+		out("int v%d; v%d = a + %d; ", i, i, i);
+	}
+}
+
+static void gen_funcs(int id) {
+	out("int f%d(int a, int b) {", id);
+	if (id) {
+		out("return f%d(a + %d, b) - a * b;", rnd(id), rnd(10));
+	}
+	else {
+		out("return a + b;");
+	}
+	out("}\n");
+}
+
+static void gen_expr(int id) {
+	out("int f%d(int a, int b) {int v0; int v1; v0 = a; v1 = b;\n\treturn ", id);
+	for (int i = 0; i < 100; i++) {
+		if (i) {
+			out("\n\t\t%s ", binops[rnd(5)]);
+		}
+		expr(20, 3, 2);
+	}
+	out(";\n}\n");
+}
+
+static void nest(int depth, int nvars) {
+	if (!depth) {
+		out("v%d = v%d + ", rnd(nvars), rnd(nvars));
+		expr(3, 1, nvars);
+		out(";");
+		return;
+	}
+	switch (rnd(3)) {
+	case 0:
+		out("if (");
+		cond(nvars);
+		out(") {");
+		nest(depth - 1, nvars);
+		out("} else {v%d = v%d - 1;}", rnd(nvars), rnd(nvars));
+		break;
+	case 1:
+		out("while (v%d < %d) {v%d = v%d + 1; ", 0, rnd(50), 0, 0);
+		nest(depth - 1, nvars);
+		out("}");
+		break;
+	default:
+		out("for (v%d = 0; v%d < %d; v%d = v%d + 1) {", 1, 1, rnd(10), 1, 1);
+		nest(depth - 1, nvars);
+		out("}");
+	}
+}
+
+static void gen_nest(int id) {
+	out("int f%d(int a, int b) {", id);
+	decls(4);
+	out("\n\t");
+	nest(40, 4);
+	out("\n\treturn v0 + v2;\n}\n");
+}
+
+static void gen_locals(int id) {
+	int n = 400;
+	out("int f%d(int a, int b) {\n", id);
+	for (int i = 0; i < n; i++) {
+		out("\tint v%d; v%d = ", i, i);
+		expr(3, 0, i);
+		out(";\n");
+	}
+	out("\treturn v%d + *&v%d;\n}\n", n - 1, rnd(n));
+}
+
+static void gen_loops(int id) {
+	out("int f%d(int a, int b) {", id);
+	decls(6);
+	out("int i; int j; int s; s = 0;\n");
+	for (int k = 0; k < 4; k++) {
+		out("\tfor (i = 0; i < %d; i = i + 1) {\n", 100000 + rnd(100000));
+		for (int n = 0; n < 30; n++) {
+			out("\t\tv%d = ", rnd(6));
+			expr(4, 1, 6);
+			out(";\n");
+		}
+		out("\t\tfor (j = 0; j < i; j = j + 1) s = s + j * v%d;\n\t}\n", rnd(6));
+	}
+	out("\treturn s;\n}\n");
+}
+
+static struct {
+	char *name;
+	void (*gen)(int id);
+} shapes[] = {
+	{"funcs", gen_funcs},
+	{"expr", gen_expr},
+	{"nest", gen_nest},
+	{"locals", gen_locals},
+	{"loops", gen_loops},
+};
+
+#define NUM_SHAPES (sizeof(shapes) / sizeof(*shapes))
+
+int main(int argc, char **argv) {
+	if (argc < 3) {
+		fprintf(stderr, "使い方: %s 種類 バイト数 [シード]\n", argv[0]);
+		return 1;
+	}
+	long size = atol(argv[2]);
+	if (argc > 3) {
+		seed = strtoul(argv[3], NULL, 10);
+	}
+
+	int shape = -1;
+	if (strcmp(argv[1], "mix")) {
+		for (int i = 0; i < NUM_SHAPES; i++) {
+			if (!strcmp(argv[1], shapes[i].name)) {
+				shape = i;
+			}
+		}
+		if (shape < 0) {
+			fprintf(stderr, "種類が正しくありません: %s\n", argv[1]);
+			return 1;
+		}
+	}
+
+	// mainの分を残して，大きさに届くまで関数を並べる
+	int id = 0;
+	do {
+		shapes[shape < 0 ? id % NUM_SHAPES : shape].gen(id);
+		id++;
+	} while (written < size - 40);
+	out("int main() {return f0(1, 2);}\n");
+	return 0;
+}
@@ -0,0 +1,36 @@
+// icount.c
+// プログラムを1命令ずつ実行して，実行した命令の数を数える
+// 使い方: icount プログラム [引数...]
+
+#include <stdio.h>
+#include <sys/ptrace.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+int main(int argc, char **argv) {
+	if (argc < 2) {
+		fprintf(stderr, "使い方: %s プログラム [引数...]\n", argv[0]);
+		return 1;
+	}
+
+	pid_t pid = fork();
+	if (pid == 0) {
+		ptrace(PTRACE_TRACEME, 0, NULL, NULL);
+		execv(argv[1], argv + 1);
+		_exit(127);
+	}
+
+	int status;
+	long count = 0;
+	waitpid(pid, &status, 0);
+	while (!WIFEXITED(status)) {
+		if (ptrace(PTRACE_SINGLESTEP, pid, NULL, NULL) < 0) {
+			perror("ptrace");
+			return 1;
+		}
+		waitpid(pid, &status, 0);
+		count++;
+	}
+	printf("%ld\n", count);
+	return 0;
+}
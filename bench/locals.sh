@@ -0,0 +1,28 @@
+#!/bin/bash
+# ローカル変数の多い関数のコンパイル時間を測る
+# 使い方: bench/locals.sh [変数の個数] [9ccのパス]
+#
+# 入力はコマンドライン引数で渡すので，1つの引数の上限(128KiB)に
+# 収まるよう変数名を短くしている
+
+n="${1:-12000}"
+cc9="${2:-./9cc}"
+
+src="$(awk -v n="$n" 'BEGIN {
+    printf "int main() {"
+    for (i = 0; i < n; i++) {
+        # 0, 1, ... を英小文字の短い名前に変換する
+        s = ""; j = i
+        do { s = sprintf("%c", 97 + j % 26) s; j = int(j / 26) } while (j > 0)
+        printf "int v%s;", s
+        if (i % 8 == 7) printf "v%s=v%s;", s, prev
+        prev = s
+    }
+    printf "v%s=1; return v%s;}", prev, prev
+}')"
+echo "locals: $n, source: ${#src} bytes"
+
+start=$(date +%s%N)
+"$cc9" "$src" > /dev/null || exit 1
+end=$(date +%s%N)
+echo "compile: $(( (end - start) / 1000000 )) ms"
@@ -0,0 +1,68 @@
+#!/bin/bash
+# 生成した大きなプログラムについて，コンパイルの段階ごとの速さを測る
+# 使い方: bench/throughput.sh [結果のファイル] [9ccのパス]
+#
+# bench/gen.cでプログラムの種類と大きさごとに入力を作り，9cc --statsの
+# 段階ごとの時間から次の速さを求める
+#   tokenize  トークン/秒
+#   program   ノード/秒(パース)
+#   codegen   アセンブリのバイト/秒(中間表現，最適化，コード生成，出力)
+# 大きさはBENCH_SIZES(既定は"4K 64K 1M 16M")，種類はBENCH_SHAPESで変えられる
+# 9ccは入力の100倍ほどのメモリを使うので，数百MBの入力には数十GBのメモリが要る
+#
+# 結果はタブ区切りで1行に1つの測定を書く．コミットごとに取っておけば差分で比べられる
+
+result="${1:-bench/throughput.tsv}"
+cc9="${2:-./9cc}"
+sizes="${BENCH_SIZES:-4K 64K 1M 16M}"
+shapes="${BENCH_SHAPES:-funcs expr nest locals loops mix}"
+dir="$(dirname "$0")"
+tmp="$(mktemp -d)"
+trap 'rm -rf "$tmp"' EXIT
+
+cc -O2 -o "$tmp/gen" "$dir/gen.c" || exit 1
+
+# 4K, 1M, 256Mなどをバイト数にする
+bytes() {
+    case "$1" in
+    *K) echo $(( ${1%K} * 1024 )) ;;
+    *M) echo $(( ${1%M} * 1024 * 1024 )) ;;
+    *) echo "$1" ;;
+    esac
+}
+
+commit="$(git -C "$dir" rev-parse --short HEAD 2> /dev/null || echo unknown)"
+printf "commit\tshape\tsize\tinput_bytes\ttokens\tnodes\tasm_bytes\ttokenize_ms\tprogram_ms\tcodegen_ms\ttotal_ms\ttokens_per_sec\tnodes_per_sec\tasm_bytes_per_sec\n" > "$result"
+
+for size in $sizes; do
+    for shape in $shapes; do
+        "$tmp/gen" "$shape" "$(bytes "$size")" > "$tmp/in.c" || exit 1
+        if ! "$cc9" --stats -o /dev/null "$tmp/in.c" 2> "$tmp/stats"; then
+            echo "$shape $size: コンパイルに失敗しました"
+            cat "$tmp/stats"
+            exit 1
+        fi
+
+        # codegenは中間表現を作るところから出力をつなぐところまで
+        awk -v commit="$commit" -v shape="$shape" -v size="$size" -v input="$(wc -c < "$tmp/in.c")" '
+            /^time tokenize:/ { tok_ms = $3 }
+            /^time parse:/ { parse_ms = $3 }
+            /^time (ir|codegen|output):/ { gen_ms += $3 }
+            /^time total:/ { total_ms = $3 }
+            /^tokens:/ { tokens = $2 }
+            /^nodes:/ { nodes = $2 + 0 }
+            /^codegen:/ { asm = $2 }
+            function rate(n, ms) { return ms > 0 ? n / ms * 1000 : 0 }
+            END {
+                printf "%s\t%s\t%s\t%d\t%d\t%d\t%d\t%.3f\t%.3f\t%.3f\t%.3f\t%.0f\t%.0f\t%.0f\n",
+                    commit, shape, size, input, tokens, nodes, asm, tok_ms, parse_ms, gen_ms, total_ms,
+                    rate(tokens, tok_ms), rate(nodes, parse_ms), rate(asm, gen_ms)
+            }' "$tmp/stats" >> "$result"
+
+        tail -n 1 "$result" | awk -F '\t' '{
+            printf "%-6s %5s: %7.1f ms, tokenize %6.2f Mtokens/s, program %6.2f Mnodes/s, codegen %6.2f MB/s\n",
+                $2, $3, $11, $12 / 1e6, $13 / 1e6, $14 / 1e6
+        }'
+    done
+done
+echo "結果: $result"
@@ -0,0 +1,107 @@
+// cache.c
+// 関数のコードのキャッシュ(--cache)
+// キーごとに1つのファイルをcache_dir/キーの上位2桁/残りの桁.s に置く
+
+#include "9cc.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// キャッシュの形式を変えたら増やす
+#define CACHE_VERSION 1
+
+// コンパイラのソースのハッシュ．Makefileが渡す
+#ifndef BUILD_ID
+#define BUILD_ID 0
+#endif
+
+// FNV-1aでpからnバイトをhに混ぜる
+static uint64_t fnv(uint64_t h, void *p, size_t n) {
+	unsigned char *s = p;
+	for (size_t i = 0; i < n; i++) {
+		h = (h ^ s[i]) * 0x100000001b3;
+	}
+	return h;
+}
+
+uint64_t cache_key(Func *func) {
+	// 9ccのビルドと，コードを変えるオプションを混ぜる
+	uint64_t build = BUILD_ID;
+	int opts[] = {
+		CACHE_VERSION, ctx->opt_peephole, ctx->opt_sccp, ctx->opt_licm,
+		ctx->opt_tailcall, ctx->inline_threshold,
+	};
+	uint64_t h = fnv(0xcbf29ce484222325, &build, sizeof(build));
+	h = fnv(h, opts, sizeof(opts));
+
+	// 空白の違いでは変わらないよう，トークンの種類と綴りを混ぜる
+	for (uint32_t i = func->name - 1; i < func->tok_end; i++) {
+		Token *tok = &ctx->tokens[i];
+		int head[2] = {tok->kind, tok->len};
+		h = fnv(h, head, sizeof(head));
+		h = fnv(h, tok->str, tok->len);
+	}
+	return h;
+}
+
+uint64_t cache_key_add(uint64_t key, uint64_t callee) {
+	return fnv(key, &callee, sizeof(callee));
+}
+
+// キーのファイルの名前．dirがあればディレクトリの名前もdirに入れる
+static void cache_path(uint64_t key, char *path, size_t size, char *dir, size_t dir_size) {
+	char hex[17];
+	snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)key);
+	if (dir) {
+		snprintf(dir, dir_size, "%s/%.2s", ctx->cache_dir, hex);
+	}
+	snprintf(path, size, "%s/%.2s/%s.s", ctx->cache_dir, hex, hex + 2);
+}
+
+bool cache_load(uint64_t key) {
+	char path[4096];
+	cache_path(key, path, sizeof(path), NULL, 0);
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+
+	struct stat st;
+	char *buf = NULL;
+	bool ok = !fstat(fd, &st) && (buf = malloc(st.st_size + 1));
+	size_t len = 0;
+	while (ok && len < (size_t)st.st_size) {
+		ssize_t n = read(fd, buf + len, st.st_size - len);
+		ok = n > 0;
+		len += ok ? n : 0;
+	}
+	close(fd);
+	if (ok) {
+		emit_strn(buf, len);
+	}
+	free(buf);
+	return ok;
+}
+
+// 同じキーを別のスレッドやプロセスが同時に書いても壊れないよう，一時ファイルに書いてから名前を替える
+void cache_store(uint64_t key, char *data, size_t len) {
+	char path[4096], dir[4096], tmp[4200];
+	cache_path(key, path, sizeof(path), dir, sizeof(dir));
+	if (mkdir(ctx->cache_dir, 0755) && errno != EEXIST) {
+		return;
+	}
+	if (mkdir(dir, 0755) && errno != EEXIST) {
+		return;
+	}
+	snprintf(tmp, sizeof(tmp), "%s/.tmpXXXXXX", dir);
+	int fd = mkstemp(tmp);
+	if (fd < 0) {
+		return;
+	}
+	bool ok = write_all(fd, data, len);
+	if (close(fd) || !ok || rename(tmp, path)) {
+		unlink(tmp);
+	}
+}
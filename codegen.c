@@ -1,297 +1,979 @@
 // codegen.c
+// 中間表現からx86-64の命令列を作る
 
 #include "9cc.h"
 
-static int num_end = 0;
-static int num_else = 0;
-static int num_begin = 0;
+#include <pthread.h>
+#include <stdatomic.h>
+#include <unistd.h>
+
+// 一時的な値を置くレジスタ
+// 呼び出し先保存レジスタなので，関数呼び出しをまたいでも値が残る
+static Reg regs[] = {REG_R12, REG_R13, REG_R14, REG_R15};
+#define NUM_REGS 4
+
+static Reg argreg[] = {REG_RDI, REG_RSI, REG_RDX, REG_RCX, REG_R8, REG_R9};
+
+// 値の置き場所(IrInst.loc)
+//   0       置かない(値が使われない)
+//   正      スタック上の[rbp-loc]
+//   負      レジスタ regs[-loc - 1]
+// 変数の値はその変数の領域に置く
+#define LOC_REG(i)	(-(i) - 1)
+
+// 値を使う最後の命令の位置(値の番号で引く)
+static _Thread_local int *last_use;
+
+// 分岐がフラグを直接使う比較か(値の番号で引く)
+static _Thread_local bool *fused;
+
+// 直前の比較で成り立つときの条件
+static _Thread_local CondCode cmp_cc;
+
+// 使ったレジスタ(regsの添字のビット)
+static _Thread_local unsigned used_regs;
+
+// 退避したレジスタ
+static _Thread_local Reg saved[NUM_REGS];
+static _Thread_local int num_saved;
+
+// 呼び出し元のrspが16の倍数だったところからスタックに積んだバイト数
+// (戻り先のアドレスを含む)．呼び出しの前には16の倍数になっていなければならない
+static _Thread_local int stack_depth;
+
+// プロローグを終えたときのstack_depth．戻るときにも同じでなければならない
+static _Thread_local int body_depth;
+
+// 末尾呼び出しをジャンプにするか(アドレスを取る関数ではしない)
+static _Thread_local bool tail_calls;
+
+// スタック上の領域の大きさ
+static _Thread_local int frame_size;
+
+// 再利用できる退避用の領域
+static _Thread_local int *free_slots;
+static _Thread_local int free_slots_len, free_slots_cap;
+
+static Operand none;
+
+// 関数ごとの最適化とコード生成
+typedef struct {
+	IrFunc *fn;
+	uint64_t key;	// キャッシュのキー
+	int worker;		// 実行したスレッド
+	size_t offset, len;	// 関数のアセンブリ(-cなら機械語)の，スレッドの出力の中の位置
+	double start, end;	// --traceでの実行した区間
+} CodegenTask;
+
+// コード生成のスレッドで分け合う仕事
+typedef struct {
+	Context *ctx;
+	CodegenTask *tasks;
+	int ntasks;
+	_Atomic int next;	// 次に取る仕事の番号
+} TaskQueue;
+
+// コード生成のスレッド
+typedef struct {
+	TaskQueue *queue;
+	int id;
+	Arena arena;	// このスレッドで作る中間表現を確保する
+	OutBuf out;		// このスレッドで作ったコード．関数ごとに後ろへ足していく
+	pthread_t thread;
+} Worker;
+
+// 条件付きジャンプ
+static void jcc(CondCode cc, Operand label) {
+	add_inst(OP_JCC, label, none)->cc = cc;
+}
+
+static Operand block_label(IrBlock *block) {
+	return opd_label(LBL_BLOCK, block->id);
+}
+
+// -- 置き場所の割り当て --
+
+// 一時的な値か(変数の値でも定数でもない)
+static bool is_temp(IrInst *inst) {
+	return !inst->var && inst->op != IR_IMM;
+}
+
+static int alloc_slot() {
+	if (free_slots_len) {
+		return free_slots[--free_slots_len];
+	}
+	frame_size += 8;
+	return frame_size;
+}
 
-static int depth;
+static void free_slot(int slot) {
+	if (free_slots_len == free_slots_cap) {
+		free_slots_cap = free_slots_cap ? free_slots_cap * 2 : 16;
+		free_slots = realloc(free_slots, sizeof(int) * free_slots_cap);
+		if (!free_slots) {
+			error("メモリが足りません");
+		}
+	}
+	free_slots[free_slots_len++] = slot;
+}
 
-static void push(char *arg) {
-	printf("    push %s\n", arg);
-	depth++;
+// 空いているレジスタを取る．なければスタック上に置く
+static int alloc_loc(unsigned *free_regs) {
+	for (int i = 0; i < NUM_REGS; i++) {
+		if (*free_regs & (1u << i)) {
+			*free_regs &= ~(1u << i);
+			used_regs |= 1u << i;
+			return LOC_REG(i);
+		}
+	}
+	return alloc_slot();
 }
 
-static void push_num(int n) {
-	printf("    push %d\n", n);
-	depth++;
+static void free_loc(unsigned *free_regs, int loc) {
+	if (loc < 0) {
+		*free_regs |= 1u << (-loc - 1);
+	}
+	else if (loc > 0) {
+		free_slot(loc);
+	}
 }
 
-static void pop(char *arg) {
-	printf("    pop %s\n", arg);
-	depth--;
+// 値を使う最後の命令の位置．他のブロックでも使われるなら-1
+#define USED_ELSEWHERE (-1)
+
+// 命令instで使い終わる引数か
+static bool dies_at(IrInst *arg, IrInst *inst) {
+	return is_temp(arg) && arg->block == inst->block && last_use[arg->id] == inst->mark;
+}
+
+// instの引数のうち，i番目より前に同じ値があるか
+static bool seen_arg(IrInst *inst, int i) {
+	for (int j = 0; j < i; j++) {
+		if (inst->args[j] == inst->args[i]) {
+			return true;
+		}
+	}
+	return false;
 }
 
-static void gen_stmt(Node *node);
-static void gen_expr(Node *node);
+// フラグを書き換えない命令か
+static bool keeps_flags(IrInst *inst) {
+	switch (inst->op) {
+	case IR_UNDEF:
+	case IR_COPY:
+	case IR_ADDR:
+	case IR_LOAD:
+	case IR_LOADVAR:
+	case IR_STOREVAR:
+		return true;
+	default:
+		return false;
+	}
+}
 
-// ローカル変数に対応するコードを生成
-static void gen_lval(Node *node) {
-	if (node->kind != ND_LVAR) {
-		error("代入の左辺値が不正です");
+// 同じブロックの比較の結果で分岐し，その間にフラグを書き換える命令がなければ
+// 比較のフラグで直接分岐する
+static void mark_fused(IrFunc *fn) {
+	fused = calloc(fn->nvalues, sizeof(bool));
+	if (!fused) {
+		error("メモリが足りません");
 	}
 
-	printf("    mov rax, rbp\n");	// raxにベースポインタの値を読み込む
-	printf("    sub rax, %d\n", node->offset);	// raxにオフセットを減算
-	push("rax");
+	for (IrBlock *b = fn->blocks; b; b = b->next) {
+		IrInst *br = b->last;
+		if (br->op != IR_BR) {
+			continue;
+		}
+		IrInst *cond = br->args[0];
+		if (cond->block != b || cond->op < IR_EQ || cond->op > IR_LE) {
+			continue;
+		}
+		IrInst *inst = br->prev;
+		while (inst != cond && keeps_flags(inst)) {
+			inst = inst->prev;
+		}
+		fused[cond->id] = inst == cond;
+	}
 }
 
-// if文に対応するコードを生成
-static void gen_if(Node *node) {
-	int lend = num_end++, lelse = num_else++;
+// 一時的な値の置き場所をブロックごとに決める
+// ブロックをまたいで使われる一時的な値はスタック上に置く
+static void assign_locs(IrFunc *fn) {
+	last_use = calloc(fn->nvalues, sizeof(int));
+	if (!last_use) {
+		error("メモリが足りません");
+	}
+	used_regs = 0;
+	free_slots_len = 0;
+
+	// 変数の値は変数の領域に置く
+	frame_size = fn->nvars * 8;
+
+	// ブロック内での命令の位置をmarkに振る
+	for (IrBlock *b = fn->blocks; b; b = b->next) {
+		int pos = 0;
+		for (IrInst *inst = b->first; inst; inst = inst->next) {
+			inst->mark = ++pos;
+			inst->loc = inst->var * 8;
+		}
+	}
 
-	gen_expr(node->cond);
-	// スタックトップに条件式の結果
-	pop("rax");
-	printf("    cmp rax, 0\n");
-	if (!node->rhs) {	// elseなし
-		printf("    je .Lend%d\n", lend);
-		gen_stmt(node->lhs);
-		printf(".Lend%d:\n", lend);
+	// 最後に使われる位置を求める
+	for (IrBlock *b = fn->blocks; b; b = b->next) {
+		for (IrInst *inst = b->first; inst; inst = inst->next) {
+			for (int i = 0; i < inst->nargs; i++) {
+				IrInst *arg = inst->args[i];
+				if (inst->op == IR_PHI && arg->var != inst->var) {
+					error("phiの引数が同じ変数の値ではありません");
+				}
+				if (!is_temp(arg) || last_use[arg->id] == USED_ELSEWHERE) {
+					continue;
+				}
+				if (inst->op == IR_BR && fused[arg->id]) {
+					// フラグで分岐するので値はいらない
+					continue;
+				}
+				last_use[arg->id] = arg->block == b ? inst->mark : USED_ELSEWHERE;
+			}
+		}
 	}
-	else {	// elseあり
-		printf("    je .Lelse%d\n", lelse);
-		gen_stmt(node->lhs);
-		printf("    jmp .Lend%d\n", lend);
-		printf(".Lelse%d:\n", lelse);
-		gen_stmt(node->rhs);
-		printf(".Lend%d:\n", lend);
+
+	for (IrBlock *b = fn->blocks; b; b = b->next) {
+		unsigned free_regs = (1u << NUM_REGS) - 1;
+
+		for (IrInst *inst = b->first; inst; inst = inst->next) {
+			IrInst *a = inst->nargs > 0 ? inst->args[0] : NULL;
+			IrInst *c = inst->nargs > 1 ? inst->args[1] : NULL;
+			int loc = 0;
+
+			// 2番地の命令になるので，使い終わる引数のレジスタに結果を置く
+			switch (inst->op) {
+			case IR_ADD:
+			case IR_MUL:
+				if (dies_at(a, inst) && a->loc < 0) {
+					loc = a->loc;
+				}
+				else if (dies_at(c, inst) && c->loc < 0) {
+					loc = c->loc;
+				}
+				break;
+			case IR_SUB:
+				if (dies_at(a, inst) && a->loc < 0) {
+					loc = a->loc;
+				}
+				else if (last_use[inst->id]) {
+					// 右辺のレジスタを結果で壊さないよう，右辺を解放する前に取る
+					loc = alloc_loc(&free_regs);
+				}
+				break;
+			}
+
+			for (int i = 0; i < inst->nargs; i++) {
+				IrInst *arg = inst->args[i];
+				if (dies_at(arg, inst) && arg->loc != loc && !seen_arg(inst, i)) {
+					free_loc(&free_regs, arg->loc);
+				}
+			}
+
+			// 戻るときには，一時的な値はどれもレジスタに残っていないはず
+			if (inst->op == IR_RET && free_regs != (1u << NUM_REGS) - 1) {
+				error("スタックの深さが異常です");
+			}
+
+			if (!is_temp(inst)) {
+				continue;
+			}
+			if (last_use[inst->id] == USED_ELSEWHERE) {
+				// 他のブロックで使われる値は専用の領域に置く
+				free_loc(&free_regs, loc);
+				frame_size += 8;
+				inst->loc = frame_size;
+			}
+			else if (!last_use[inst->id]) {
+				free_loc(&free_regs, loc);
+				inst->loc = 0;
+			}
+			else {
+				inst->loc = loc ? loc : alloc_loc(&free_regs);
+			}
+		}
 	}
+	free(last_use);
 }
 
-// while文のコードを生成
-static void gen_while(Node *node) {
-	int lbegin = num_begin++, lend = num_end++;
+// -- 命令の生成 --
 
-	printf(".Lbegin%d:\n", lbegin);
-	gen_expr(node->cond);
-	pop("rax");
+static bool same_opd(Operand a, Operand b) {
+	return a.kind == b.kind && a.reg == b.reg && a.val == b.val;
+}
 
-	printf("    cmp rax, 0\n");
-	printf("    je .Lend%d\n", lend);
-	gen_stmt(node->lhs);
-	printf("    jmp .Lbegin%d\n", lbegin);
-	printf(".Lend%d:\n", lend);
+static bool fits_imm32(int64_t val) {
+	return val == (int32_t)val;
 }
 
-// for文のコードを生成
-static void gen_for(Node *node) {
-	int lbegin = num_begin++, lend = num_end++;
+// 値のオペランド
+static Operand val_opd(IrInst *inst) {
+	if (inst->op == IR_IMM) {
+		return opd_imm(inst->val);
+	}
+	if (inst->loc < 0) {
+		return opd_reg(regs[-inst->loc - 1]);
+	}
+	return opd_mem(REG_RBP, -inst->loc);
+}
 
-	if (node->lhs) {
-		gen_expr(node->lhs);
-		pop("rax");
+// 即値が32ビットに収まらなければscratchに移す
+static Operand fit_imm(Operand opd, Reg scratch) {
+	if (opd.kind == OPD_IMM && !fits_imm32(opd.val)) {
+		add_inst(OP_MOV, opd_reg(scratch), opd);
+		return opd_reg(scratch);
 	}
+	return opd;
+}
 
-	printf(".Lbegin%d:\n", lbegin);
-	if (node->cond) {
-		gen_expr(node->cond);
-		pop("rax");
+// srcをdstに移す．メモリ同士はraxを経由する
+static void move(Operand dst, Operand src) {
+	if (same_opd(dst, src)) {
+		return;
+	}
+	if (dst.kind == OPD_MEM && (src.kind == OPD_MEM || (src.kind == OPD_IMM && !fits_imm32(src.val)))) {
+		add_inst(OP_MOV, opd_reg(REG_RAX), src);
+		src = opd_reg(REG_RAX);
+	}
+	add_inst(OP_MOV, dst, src);
+}
 
-		printf("    cmp rax, 0\n");
-		printf("    je .Lend%d\n", lend);
+// 結果を求めるレジスタ．置き場所がレジスタでなければraxを使う
+static Operand result_reg(IrInst *inst) {
+	if (inst->loc < 0) {
+		return val_opd(inst);
 	}
-	gen_stmt(node->rhs);
-	if (node->inc) {
-		gen_expr(node->inc);
-		pop("rax");
+	return opd_reg(REG_RAX);
+}
+
+// 結果をレジスタから置き場所に移す
+static void store_result(IrInst *inst, Operand r) {
+	if (inst->loc) {
+		move(val_opd(inst), r);
 	}
-	printf("    jmp .Lbegin%d\n", lbegin);
-	printf(".Lend%d:\n", lend);
 }
 
-// blockのコードを生成
-static void gen_block(Node *node) {
-	Node *cur = node->next;
-	while (cur) {
-		gen_stmt(cur);
-		//pop("rax");
-		cur = cur->next;
+// 2の冪ならその指数，そうでなければ-1を返す
+static int log2_exact(uint64_t u) {
+	if (u == 0 || (u & (u - 1))) {
+		return -1;
 	}
+	int k = 0;
+	while (u >>= 1) {
+		k++;
+	}
+	return k;
 }
 
-static char *argreg[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
+// xの定数倍をシフト，lea，加減算でrに求める
+// 分解できなければ偽を返す
+static bool gen_mul_const(Operand r, Operand x, int64_t c) {
+	if (!fits_imm32(c) || x.kind == OPD_IMM) {
+		return false;
+	}
+	uint64_t u = c < 0 ? -(uint64_t)c : c;
+	int k;
 
-// 関数呼び出しのコードを生成
-static void gen_funcall(Node *node) {
-	Node *cur = node->args;
-	int i, n = 0;
-	while (cur) {
-		gen_expr(cur);
-		cur = cur->next;
-		n++;
+	if (u == 0) {
+		add_inst(OP_MOV, r, opd_imm(0));
+		return true;
+	}
+	if ((k = log2_exact(u)) >= 0) {
+		// x * 2^k => x << k
+		move(r, x);
+		if (k) {
+			add_inst(OP_SHL, r, opd_imm(k));
+		}
+	}
+	else if ((u % 3 == 0 && (k = log2_exact(u / 3)) >= 0) ||
+			(u % 5 == 0 && (k = log2_exact(u / 5)) >= 0) ||
+			(u % 9 == 0 && (k = log2_exact(u / 9)) >= 0)) {
+		// x * {3, 5, 9} * 2^k => lea r, [x+x*{2, 4, 8}]; shl r, k
+		int m = u >> k;
+		if (x.kind != OPD_REG) {
+			move(r, x);
+			x = r;
+		}
+		add_inst(OP_LEA, r, opd_mem_index(x.reg, x.reg, m - 1, 0));
+		if (k) {
+			add_inst(OP_SHL, r, opd_imm(k));
+		}
+	}
+	else if ((k = log2_exact(u - 1)) >= 0 || (k = log2_exact(u + 1)) >= 0) {
+		// x * (2^k ± 1) => (x << k) ± x
+		InstOp op = (uint64_t)1 << k == u - 1 ? OP_ADD : OP_SUB;
+		if (x.kind != OPD_REG || same_opd(x, r)) {
+			add_inst(OP_MOV, opd_reg(REG_RDI), x);
+			x = opd_reg(REG_RDI);
+		}
+		move(r, x);
+		add_inst(OP_SHL, r, opd_imm(k));
+		add_inst(op, r, x);
 	}
-	for (i = 0; i < n; i++) {
-		pop(argreg[i]);
+	else {
+		return false;
 	}
-	// rspを16の倍数に
-	printf("    mov rbx, 0x000F\n");
-	printf("    and rbx, rsp\n");
-	printf("    cmp rbx, 0\n");
-	printf("    je .L%.*s\n", node->len, node->name);
-	printf("    sub rsp, 8\n");
-	printf(".L%.*s:\n", node->len, node->name);
 
-	printf("    call %.*s\n", node->len, node->name);
+	if (c < 0) {
+		add_inst(OP_NEG, r, none);
+	}
+	ctx->strength_reduced++;
+	return true;
 }
 
-// expr
-static void gen_expr(Node *node) {
-	// 整数またはローカル変数，代入式，return文
-	switch (node->kind) {
-	case ND_NUM:
-		push_num(node->val);
-		return;
-	case ND_LVAR:	// ローカル変数の場合，アドレスから値を取り出す
-		gen_lval(node);
-		pop("rax");
-		printf("    mov rax, [rax]\n");
-		push("rax");
-		return;
-	case ND_ASSIGN:
-		gen_lval(node->lhs);
-		gen_expr(node->rhs);
-
-		pop("rdi");
-		pop("rax");
-		printf("    mov [rax], rdi\n");
-		push("rdi");
+static void gen_arith(IrInst *inst) {
+	static InstOp ops[] = {[IR_ADD] = OP_ADD, [IR_SUB] = OP_SUB, [IR_MUL] = OP_IMUL};
+	Operand a = val_opd(inst->args[0]);
+	Operand b = val_opd(inst->args[1]);
+	Operand r = result_reg(inst);
+
+	if (inst->op == IR_MUL) {
+		if (a.kind == OPD_IMM) {
+			Operand t = a;
+			a = b;
+			b = t;
+		}
+		if (b.kind == OPD_IMM && gen_mul_const(r, a, b.val)) {
+			store_result(inst, r);
+			return;
+		}
+	}
+
+	if (inst->op != IR_SUB && same_opd(r, b)) {
+		Operand t = a;
+		a = b;
+		b = t;
+	}
+	move(r, a);
+	add_inst(ops[inst->op], r, fit_imm(b, REG_RDI));
+	store_result(inst, r);
+}
+
+// 符号付き64ビットの除算を乗算に置き換えるための魔法数と
+// シフト量を求める(Hacker's Delight 10-1)
+static void signed_magic(int64_t d, int64_t *magic, int *shift) {
+	const uint64_t two63 = (uint64_t)1 << 63;
+	uint64_t ad = d < 0 ? -(uint64_t)d : d;
+	uint64_t t = two63 + ((uint64_t)d >> 63);
+	uint64_t anc = t - 1 - t % ad;
+	uint64_t q1 = two63 / anc, r1 = two63 - q1 * anc;
+	uint64_t q2 = two63 / ad, r2 = two63 - q2 * ad;
+	uint64_t delta;
+	int p = 63;
+
+	do {
+		p++;
+		q1 *= 2;
+		r1 *= 2;
+		if (r1 >= anc) {
+			q1++;
+			r1 -= anc;
+		}
+		q2 *= 2;
+		r2 *= 2;
+		if (r2 >= ad) {
+			q2++;
+			r2 -= ad;
+		}
+		delta = ad - r2;
+	} while (q1 < delta || (q1 == delta && r1 == 0));
+
+	*magic = d < 0 ? -(int64_t)(q2 + 1) : (int64_t)(q2 + 1);
+	*shift = p - 64;
+}
+
+// 定数で割る
+// 2の冪は符号の補正とシフト，それ以外は魔法数の乗算に置き換える
+static void gen_div_const(IrInst *inst, Operand x, int64_t d) {
+	uint64_t u = d < 0 ? -(uint64_t)d : d;
+	int k = log2_exact(u);
+
+	if (k >= 0) {
+		// 負の数は切り捨てが0の方へ向くよう2^k - 1を足してからシフトする
+		move(opd_reg(REG_RAX), x);
+		if (k) {
+			add_inst(OP_CQO, none, none);
+			add_inst(OP_SHR, opd_reg(REG_RDX), opd_imm(64 - k));
+			add_inst(OP_ADD, opd_reg(REG_RAX), opd_reg(REG_RDX));
+			add_inst(OP_SAR, opd_reg(REG_RAX), opd_imm(k));
+		}
+		if (d < 0) {
+			add_inst(OP_NEG, opd_reg(REG_RAX), none);
+		}
+		store_result(inst, opd_reg(REG_RAX));
+		ctx->strength_reduced++;
 		return;
-	case ND_FUNCALL:
-		gen_funcall(node);
-		push("rax");
+	}
+
+	int64_t magic;
+	int shift;
+	signed_magic(d, &magic, &shift);
+
+	// rdx = x * magicの上位64ビット
+	if (x.kind == OPD_IMM) {
+		add_inst(OP_MOV, opd_reg(REG_RDI), x);
+		x = opd_reg(REG_RDI);
+	}
+	add_inst(OP_MOV, opd_reg(REG_RAX), opd_imm(magic));
+	add_inst(OP_IMUL, x, none);
+	if (d > 0 && magic < 0) {
+		add_inst(OP_ADD, opd_reg(REG_RDX), x);
+	}
+	if (d < 0 && magic > 0) {
+		add_inst(OP_SUB, opd_reg(REG_RDX), x);
+	}
+	if (shift) {
+		add_inst(OP_SAR, opd_reg(REG_RDX), opd_imm(shift));
+	}
+	// 商が負なら1を足して0の方へ切り捨てる
+	add_inst(OP_MOV, opd_reg(REG_RAX), opd_reg(REG_RDX));
+	add_inst(OP_SHR, opd_reg(REG_RAX), opd_imm(63));
+	add_inst(OP_ADD, opd_reg(REG_RDX), opd_reg(REG_RAX));
+	store_result(inst, opd_reg(REG_RDX));
+	ctx->strength_reduced++;
+}
+
+static void gen_div(IrInst *inst) {
+	Operand b = val_opd(inst->args[1]);
+
+	if (b.kind == OPD_IMM && b.val != 0 && fits_imm32(b.val)) {
+		gen_div_const(inst, val_opd(inst->args[0]), b.val);
 		return;
-	case ND_ADDR:
-		gen_lval(node->lhs);
+	}
+
+	add_inst(OP_MOV, opd_reg(REG_RAX), val_opd(inst->args[0]));
+	add_inst(OP_CQO, none, none);
+	if (b.kind == OPD_IMM) {
+		add_inst(OP_MOV, opd_reg(REG_RDI), b);
+		b = opd_reg(REG_RDI);
+	}
+	add_inst(OP_IDIV, b, none);
+	store_result(inst, opd_reg(REG_RAX));
+}
+
+// 比較してフラグを立て，成り立つときの条件を返す
+static CondCode gen_cmp(IrInst *inst) {
+	static CondCode ccs[] = {[IR_EQ] = CC_E, [IR_NE] = CC_NE, [IR_LT] = CC_L, [IR_LE] = CC_LE};
+	// 左右を入れ替えたときの条件
+	static CondCode swapped[] = {[IR_EQ] = CC_E, [IR_NE] = CC_NE, [IR_LT] = CC_G, [IR_LE] = CC_GE};
+	Operand a = val_opd(inst->args[0]);
+	Operand b = val_opd(inst->args[1]);
+	CondCode cc = ccs[inst->op];
+
+	if (a.kind == OPD_IMM && b.kind != OPD_IMM && fits_imm32(a.val)) {
+		Operand t = a;
+		a = b;
+		b = t;
+		cc = swapped[inst->op];
+	}
+	b = fit_imm(b, REG_RDI);
+	if (a.kind == OPD_IMM || (a.kind == OPD_MEM && b.kind == OPD_MEM)) {
+		add_inst(OP_MOV, opd_reg(REG_RAX), a);
+		a = opd_reg(REG_RAX);
+	}
+	add_inst(OP_CMP, a, b);
+	return cc;
+}
+
+static void gen_compare(IrInst *inst) {
+	cmp_cc = gen_cmp(inst);
+
+	// 分岐にしか使わなければ0/1の値は作らない
+	// setcc, movzbはフラグを書き換えない
+	if (!inst->loc) {
 		return;
-	case ND_DEREF:
-		gen_expr(node->lhs);
-		pop("rax");
-		printf("    mov rax, [rax]\n");
-		push("rax");
+	}
+	Operand r = result_reg(inst);
+	add_inst(OP_SETCC, opd_reg(REG_RAX), none)->cc = cmp_cc;
+	add_inst(OP_MOVZB, r, opd_reg(REG_RAX));
+	store_result(inst, r);
+}
+
+// 条件が成り立てばthen，成り立たなければelsへ分岐する
+static void gen_branch(CondCode cc, IrBlock *then, IrBlock *els, IrBlock *next) {
+	if (els == next) {
+		jcc(cc, block_label(then));
 		return;
 	}
+	jcc(cc ^ 1, block_label(els));
+	if (then != next) {
+		add_inst(OP_JMP, block_label(then), none);
+	}
+}
+
+static void gen_call(IrInst *inst) {
+	for (int i = 0; i < inst->nargs; i++) {
+		move(opd_reg(argreg[i]), val_opd(inst->args[i]));
+	}
+
+	// プロローグでrspを16の倍数にそろえてあるので，そのまま呼び出せる
+	if (stack_depth % 16) {
+		error("呼び出しの前のrspが16の倍数になっていません");
+	}
+	add_inst(OP_CALL, opd_sym(inst->val), opd_imm(inst->nargs));
+
+	store_result(inst, opd_reg(REG_RAX));
+}
+
+// 退避したレジスタを戻し，フレームを片付ける
+static void gen_teardown() {
+	if (stack_depth != body_depth) {
+		error("スタックの深さが異常です");
+	}
+	for (int i = num_saved - 1; i >= 0; i--) {
+		add_inst(OP_POP, opd_reg(saved[i]), none);
+	}
+	add_inst(OP_MOV, opd_reg(REG_RSP), opd_reg(REG_RBP));
+	add_inst(OP_POP, opd_reg(REG_RBP), none);
+}
+
+// 関数から戻る
+static void gen_epilogue() {
+	gen_teardown();
+	add_inst(OP_RET, none, none);
+}
+
+// 呼び出しの値をそのまま返すなら，フレームを片付けて呼び出し先へジャンプする
+// 呼び出し先はこの関数の戻り先へ直接戻る．
+// フレームを指すポインタがあると呼び出し先で使えなくなるので，アドレスを取る関数ではしない
+static bool is_tail_call(IrInst *inst) {
+	IrInst *ret = inst->next;
+	return tail_calls && inst->op == IR_CALL && ret && ret->op == IR_RET && ret->args[0] == inst;
+}
+
+static void gen_tail_call(IrInst *inst) {
+	for (int i = 0; i < inst->nargs; i++) {
+		move(opd_reg(argreg[i]), val_opd(inst->args[i]));
+	}
+	gen_teardown();
+	add_inst(OP_JMP, opd_sym(inst->val), opd_imm(inst->nargs));
+	ctx->tail_jumps++;
+}
 
-	// ASTを帰りがけ順で走査
-	gen_expr(node->lhs);
-	gen_expr(node->rhs);
-
-	// 結果がスタックのトップから2つに入っている
-	pop("rdi");
-	pop("rax");
-
-	switch (node->kind) {
-	case ND_ADD:
-		printf("    add rax, rdi\n");
-		break;
-	case ND_SUB:
-		printf("    sub rax, rdi\n");
-		break;
-	case ND_MUL:
-		printf("    imul rax, rdi\n");
-		break;
-	case ND_DIV:
-		printf("    cqo\n");
-		printf("    idiv rdi\n");
-		break;
-	case ND_EQ:
-		printf("    cmp rax, rdi\n");
-		printf("    sete al\n");
-		printf("    movzb rax, al\n");
-		break;
-	case ND_NEQ:
-		printf("    cmp rax, rdi\n");
-		printf("    setne al\n");
-		printf("    movzb rax, al\n");
-		break;
-	case ND_LE:
-		printf("    cmp rax, rdi\n");
-		printf("    setl al\n");
-		printf("    movzb rax, al\n");
-		break;
-	case ND_LEQ:
-		printf("    cmp rax, rdi\n");
-		printf("    setle al\n");
-		printf("    movzb rax, al\n");
-		break;
-	}
-	// 演算結果をスタックにプッシュ
-	push("rax");
-}
-
-// stmt
-static void gen_stmt(Node *node) {
-	int lbegin, lend, lelse;
-	switch (node->kind) {
-	case ND_RETURN:
-		gen_expr(node->lhs);
-		// 結果がスタックトップに入っている
-		pop("rax");
-
-		// epilogue
-		printf("    mov rsp, rbp\n");
-		printf("    pop rbp\n");
-		printf("    ret\n");
+static void gen_inst(IrInst *inst, IrBlock *next) {
+	IrBlock *block = inst->block;
+	Operand r, p;
+
+	switch (inst->op) {
+	case IR_UNDEF:
+	case IR_PHI:
+		// 同じ変数の値は同じ場所にあるので何もしない
 		return;
-	case ND_IF:
-		gen_if(node);
+	case IR_PARAM:
+		store_result(inst, opd_reg(argreg[inst->val]));
 		return;
-	case ND_WHILE:
-		gen_while(node);
+	case IR_COPY:
+		move(val_opd(inst), val_opd(inst->args[0]));
 		return;
-	case ND_FOR:
-		gen_for(node);
+	case IR_ADD:
+	case IR_SUB:
+	case IR_MUL:
+		gen_arith(inst);
 		return;
-	case ND_BLOCK:
-		gen_block(node);
+	case IR_DIV:
+		gen_div(inst);
+		return;
+	case IR_EQ:
+	case IR_NE:
+	case IR_LT:
+	case IR_LE:
+		gen_compare(inst);
+		return;
+	case IR_ADDR:
+		r = result_reg(inst);
+		add_inst(OP_LEA, r, opd_mem(REG_RBP, -inst->val * 8));
+		store_result(inst, r);
+		return;
+	case IR_LOAD:
+		p = val_opd(inst->args[0]);
+		if (p.kind != OPD_REG) {
+			add_inst(OP_MOV, opd_reg(REG_RAX), p);
+			p = opd_reg(REG_RAX);
+		}
+		r = result_reg(inst);
+		add_inst(OP_MOV, r, opd_mem(p.reg, 0));
+		store_result(inst, r);
+		return;
+	case IR_LOADVAR:
+		r = result_reg(inst);
+		add_inst(OP_MOV, r, opd_mem(REG_RBP, -inst->val * 8));
+		store_result(inst, r);
+		return;
+	case IR_STOREVAR:
+		move(opd_mem(REG_RBP, -inst->val * 8), val_opd(inst->args[0]));
+		return;
+	case IR_CALL:
+		if (is_tail_call(inst)) {
+			gen_tail_call(inst);
+			return;
+		}
+		gen_call(inst);
+		return;
+	case IR_JMP:
+		if (block->succ[0] != next) {
+			add_inst(OP_JMP, block_label(block->succ[0]), none);
+		}
+		return;
+	case IR_BR:
+		if (fused[inst->args[0]->id]) {
+			gen_branch(cmp_cc, block->succ[0], block->succ[1], next);
+			return;
+		}
+		p = val_opd(inst->args[0]);
+		if (p.kind == OPD_IMM) {
+			add_inst(OP_MOV, opd_reg(REG_RAX), p);
+			p = opd_reg(REG_RAX);
+		}
+		add_inst(OP_CMP, p, opd_imm(0));
+		gen_branch(CC_NE, block->succ[0], block->succ[1], next);
+		return;
+	case IR_RET:
+		if (inst->prev && is_tail_call(inst->prev)) {
+			return;
+		}
+		move(opd_reg(REG_RAX), val_opd(inst->args[0]));
+		gen_epilogue();
 		return;
-	default:
-		gen_expr(node);
-		pop("rax");
 	}
 }
 
-void gen_def_func(Node *node) {
-	printf(".globl %.*s\n", node->len, node->name);
-	printf("%.*s:\n", node->len, node->name);
+static void gen_func(IrFunc *fn) {
+	tail_calls = ctx->opt_tailcall;
+	for (IrBlock *b = fn->blocks; b; b = b->next) {
+		for (IrInst *inst = b->first; inst; inst = inst->next) {
+			tail_calls &= inst->op != IR_ADDR;
+		}
+	}
+	mark_fused(fn);
+	assign_locs(fn);
+
+	add_inst(OP_FUNC, opd_sym(ctx->node_pool[fn->node + 1]), none);
+
+	// 使うレジスタだけ退避する
+	num_saved = 0;
+	for (int i = 0; i < NUM_REGS; i++) {
+		if (used_regs & (1u << i)) {
+			saved[num_saved++] = regs[i];
+		}
+	}
 
 	// prologue
-	// 変数26個(a~z)分の領域を確保する
-	printf("    push rbp\n");
-	printf("    mov rbp, rsp\n");
-	printf("    sub rsp, 208\n");
+	// 退避したレジスタを積んだ後でrspが16の倍数になるよう，フレームの大きさを決める
+	int frame = (frame_size + num_saved * 8 + 15) / 16 * 16 - num_saved * 8;
+	stack_depth = 8;	// 戻り先のアドレス
+	add_inst(OP_PUSH, opd_reg(REG_RBP), none);
+	stack_depth += 8;
+	add_inst(OP_MOV, opd_reg(REG_RBP), opd_reg(REG_RSP));
+	if (frame) {
+		add_inst(OP_SUB, opd_reg(REG_RSP), opd_imm(frame));
+		stack_depth += frame;
+	}
+	for (int i = 0; i < num_saved; i++) {
+		add_inst(OP_PUSH, opd_reg(saved[i]), none);
+		stack_depth += 8;
+	}
+	body_depth = stack_depth;
+
+	for (IrBlock *b = fn->blocks; b; b = b->next) {
+		if (b != fn->blocks) {
+			add_inst(OP_LABEL, block_label(b), none);
+		}
+		for (IrInst *inst = b->first; inst; inst = inst->next) {
+			gen_inst(inst, b->next);
+		}
+	}
+	free(fused);
+}
+
+// 1つの関数を最適化し，コードをoutの後ろに作る
+static void run_task(CodegenTask *task, OutBuf *out) {
+	IrFunc *fn = task->fn;
+	task->offset = out->len;
+	emit_to(out);
+
+	// アセンブリはキャッシュにあればそれを使い，なければ作ったものを書いておく
+	bool cache = ctx->cache_dir && !ctx->opt_dump_ir && !ctx->opt_object;
+	if (cache && cache_load(task->key)) {
+		ctx->cache_hits++;
+		task->len = out->len - task->offset;
+		emit_to(NULL);
+		return;
+	}
+
+	if (ctx->opt_tailcall) {
+		tail_recursion(fn);
+	}
+	if (ctx->opt_sccp) {
+		sccp(fn);
+	}
+	dce(fn);
+	if (ctx->opt_licm) {
+		licm(fn);
+	}
 
-	Node *arg = node->args;
-	int i = 0;
+	if (ctx->opt_dump_ir) {
+		dump_ir(fn);
+	}
+	else {
+		gen_func(fn);
+		if (ctx->opt_peephole) {
+			peephole();
+		}
+		flush_insts();
+	}
+	task->len = out->len - task->offset;
+	if (cache) {
+		cache_store(task->key, out->data + task->offset, task->len);
+		ctx->cache_misses++;
+	}
+	emit_to(NULL);
+}
 
-	while (arg) {
-		printf("    mov rax, rbp\n");
-		printf("    sub rax, %d\n", arg->offset);
-		printf("    mov [rax], %s\n", argreg[i++]);
-		
-		arg = arg->next;
+// 残っている関数を順に取って片付ける
+// エラーになったら他のスレッドにも残りを取らせない
+static void *run_tasks(void *arg) {
+	Worker *w = arg;
+	TaskQueue *q = w->queue;
+	Context *save_ctx = ctx;
+	jmp_buf *save_jmp = error_jmp;
+	Arena *save_arena = ir_arena;
+
+	jmp_buf jmp;
+	ctx = q->ctx;
+	error_jmp = &jmp;
+	ir_arena = &w->arena;
+	if (!setjmp(jmp)) {
+		for (int i; (i = q->next++) < q->ntasks;) {
+			CodegenTask *task = &q->tasks[i];
+			task->worker = w->id;
+			if (ctx->opt_trace) {
+				task->start = now();
+			}
+			run_task(task, &w->out);
+			if (ctx->opt_trace) {
+				task->end = now();
+			}
+		}
+	}
+	else {
+		q->next = q->ntasks;
+		emit_to(NULL);
 	}
 
-	gen_block(node->body);
+	ctx = save_ctx;
+	error_jmp = save_jmp;
+	ir_arena = save_arena;
+	return NULL;
+}
 
-	// epilogue
-	// スタックトップの値が答え
-	printf("    mov rsp, rbp\n");
-	printf("    pop rbp\n");
-	printf("    ret\n");
+// spareからmax個までのスレッドを借りる
+static int borrow_threads(_Atomic int *spare, int max) {
+	int n = *spare;
+	int take;
+	do {
+		take = n < max ? n : max;
+		if (take <= 0) {
+			return 0;
+		}
+	} while (!atomic_compare_exchange_weak(spare, &n, n - take));
+	return take;
 }
 
 void codegen() {
-	depth = 0;
-
 	// アセンブリの前半部分を出力
-    printf(".intel_syntax noprefix\n");
-    
-	// ASTからコード生成
-	int i;
-	for (i = 0; code[i] != NULL; i++) {
-		gen_def_func(code[i]);
-		if (depth) error("スタックの深さが異常です");
-	}
-}
\ No newline at end of file
+	if (!ctx->opt_dump_ir && !ctx->opt_object) {
+		emit(".intel_syntax noprefix\n");
+	}
+
+	// 小さな関数は呼び出し元に展開するので，中間表現は先にすべて作っておく
+	double t = now();
+	TaskQueue q = {.ctx = ctx};
+	for (int i = 0; ctx->code[i]; i++) {
+		q.ntasks++;
+	}
+	q.tasks = calloc(q.ntasks + 1, sizeof(CodegenTask));
+	if (!q.tasks) {
+		error("メモリが足りません");
+	}
+	for (int i = 0; i < q.ntasks; i++) {
+		Func *func = find_func(FUNC_NAME(ctx->code[i]));
+		q.tasks[i].fn = inline_ir(func);
+		q.tasks[i].key = func->key;
+	}
+	t = end_phase(PHASE_IR, t);
+
+	// 関数ごとの最適化とコード生成は互いに独立なので，スレッドで分け合う
+	// このスレッドも1つ目のスレッドとして働く
+	int nthreads = ctx->codegen_threads > 0 ? ctx->codegen_threads : (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if (nthreads > q.ntasks) {
+		nthreads = q.ntasks;
+	}
+	if (nthreads < 1) {
+		nthreads = 1;
+	}
+	int borrowed = 0;
+	if (ctx->spare_threads) {
+		borrowed = borrow_threads(ctx->spare_threads, q.ntasks - nthreads);
+		nthreads += borrowed;
+	}
+	Worker *workers = calloc(nthreads, sizeof(Worker));
+	if (!workers) {
+		error("メモリが足りません");
+	}
+	// スレッドを作れなければ，作れた分だけで進める
+	int started = 1;
+	for (; started < nthreads; started++) {
+		workers[started].queue = &q;
+		workers[started].id = started;
+		if (pthread_create(&workers[started].thread, NULL, run_tasks, &workers[started])) {
+			break;
+		}
+	}
+	workers[0].queue = &q;
+	run_tasks(&workers[0]);
+	for (int i = 0; i < nthreads; i++) {
+		if (i && i < started) {
+			pthread_join(workers[i].thread, NULL);
+		}
+		ctx->codegen_bytes += workers[i].arena.reserved + workers[i].out.cap;
+		arena_free(&workers[i].arena);
+	}
+	if (borrowed) {
+		*ctx->spare_threads += borrowed;
+	}
+	t = end_phase(PHASE_CODEGEN, t);
+
+	// ソースの順につなぐので，出力はスレッドの数によらない
+	for (int i = 0; i < q.ntasks; i++) {
+		CodegenTask *task = &q.tasks[i];
+		if (!ctx->failed) {
+			char *data = workers[task->worker].out.data + task->offset;
+			if (ctx->opt_object && !ctx->opt_dump_ir) {
+				add_func_text(find_func(FUNC_NAME(ctx->code[i])), data, task->len);
+			}
+			else {
+				emit_strn(data, task->len);
+			}
+		}
+		if (ctx->opt_trace) {
+			Token *name = FUNC_NAME(ctx->code[i]);
+			add_span("function", name->str, name->len, task->worker, task->start, task->end);
+		}
+	}
+	for (int i = 0; i < nthreads; i++) {
+		free(workers[i].out.data);
+	}
+	free(workers);
+	free(q.tasks);
+	end_phase(PHASE_OUTPUT, t);
+
+	// スレッドで起きたエラーを呼び出し元に伝える
+	if (ctx->failed) {
+		longjmp(*error_jmp, 1);
+	}
+}
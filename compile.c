@@ -0,0 +1,111 @@
+// compile.c
+// コンパイラの文脈と，ライブラリとして呼び出す入口
+
+#include "9cc.h"
+
+#include <time.h>
+
+// このスレッドで処理中の文脈
+_Thread_local Context *ctx;
+
+// このスレッドのエラーの戻り先
+_Thread_local jmp_buf *error_jmp;
+
+double now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// 既定のオプションで文脈を作る
+Context *new_context() {
+	Context *c = calloc(1, sizeof(Context));
+	if (!c) {
+		return NULL;
+	}
+	c->opt_peephole = true;
+	c->opt_sccp = true;
+	c->opt_licm = true;
+	c->opt_tailcall = true;
+	c->inline_threshold = 24;
+	return c;
+}
+
+void copy_options(Context *dst, Context *src) {
+	dst->opt_dump_ir = src->opt_dump_ir;
+	dst->opt_object = src->opt_object;
+	dst->opt_peephole = src->opt_peephole;
+	dst->opt_sccp = src->opt_sccp;
+	dst->opt_licm = src->opt_licm;
+	dst->opt_tailcall = src->opt_tailcall;
+	dst->opt_inline_report = src->opt_inline_report;
+	dst->inline_threshold = src->inline_threshold;
+	dst->codegen_threads = src->codegen_threads;
+	dst->cache_dir = src->cache_dir;
+	dst->opt_trace = src->opt_trace;
+}
+
+// 文脈とそれが持つものをすべて解放する
+void free_context(Context *c) {
+	if (!c) {
+		return;
+	}
+	// エラーで止まったときは.textに置く前の呼び出しが残っている
+	for (Func *func = c->functions; func; func = func->next) {
+		free(func->calls);
+	}
+	free(c->tokens);
+	free(c->node_pool);
+	free(c->code);
+	free(c->child_stack);
+	free(c->lvar_buckets);
+	free(c->scope_vars);
+	free(c->func_buckets);
+	free(c->pending_calls);
+	free(c->su_cache);
+	free(c->text);
+	free(c->obj_calls);
+	free(c->spans);
+	free(c->error_msg);
+	arena_free(&c->arena);
+	free(c);
+}
+
+// srcからlenバイトのプログラムをコンパイルし，outに出力する
+// エラーはerror_jmpでここに戻り，0以外を返す
+int compile(Context *c, char *src, size_t len, OutBuf *out) {
+	Context *save_ctx = ctx;
+	jmp_buf *save_jmp = error_jmp;
+	Arena *save_arena = ir_arena;
+
+	jmp_buf jmp;
+	ctx = c;
+	error_jmp = &jmp;
+	ir_arena = &c->arena;
+	c->out = out;
+	c->start_time = now();
+	if (!setjmp(jmp)) {
+		// トークナイズしてパースする
+		// 結果(AST)はc->codeに保存される
+		double t = c->start_time;
+		tokenize(src, len);
+		t = end_phase(PHASE_TOKENIZE, t);
+		program();
+		t = end_phase(PHASE_PARSE, t);
+		fold();
+		end_phase(PHASE_FOLD, t);
+
+		// コード生成の段階はcodegenの中で計る
+		codegen();
+		if (c->opt_object && !c->opt_dump_ir && out) {
+			t = now();
+			write_object();
+			end_phase(PHASE_OUTPUT, t);
+		}
+	}
+
+	ctx = save_ctx;
+	error_jmp = save_jmp;
+	ir_arena = save_arena;
+	return c->failed;
+}
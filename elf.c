@@ -0,0 +1,192 @@
+// elf.c
+// ELF64の再配置可能オブジェクトの出力
+
+#include "9cc.h"
+
+#include <elf.h>
+
+// 文字列表
+typedef struct {
+	char *data;
+	int len, cap;
+} StrTab;
+
+// 文字列を追加し，その位置を返す
+static int strtab_add(StrTab *t, char *s, int len) {
+	if (t->len + len + 1 > t->cap) {
+		t->cap = (t->len + len + 1) * 2;
+		t->data = realloc(t->data, t->cap);
+		if (!t->data) {
+			error("メモリが足りません");
+		}
+	}
+	int pos = t->len;
+	memcpy(t->data + pos, s, len);
+	t->data[pos + len] = '\0';
+	t->len += len + 1;
+	return pos;
+}
+
+// セクションの番号
+enum {
+	SEC_NULL,
+	SEC_TEXT,
+	SEC_RELA_TEXT,
+	SEC_SYMTAB,
+	SEC_STRTAB,
+	SEC_SHSTRTAB,
+	SEC_NOTE_STACK,	// スタックを実行可能にしない印
+	NUM_SECS,
+};
+
+static char *sec_names[] = {
+	[SEC_TEXT] = ".text", [SEC_RELA_TEXT] = ".rela.text", [SEC_SYMTAB] = ".symtab",
+	[SEC_STRTAB] = ".strtab", [SEC_SHSTRTAB] = ".shstrtab", [SEC_NOTE_STACK] = ".note.GNU-stack",
+};
+
+static void emit_bytes(void *p, size_t len) {
+	emit_strn(p, len);
+}
+
+// 8バイト境界までゼロで埋める
+static void emit_pad(size_t *pos) {
+	static char zero[8];
+	size_t n = -*pos & 7;
+	emit_bytes(zero, n);
+	*pos += n;
+}
+
+void write_object() {
+	// 関数のシンボル．ローカルなシンボルはないので，先頭の空のもの以外はすべてグローバル
+	int nfuncs = 0;
+	for (int i = 0; ctx->code[i]; i++) {
+		nfuncs++;
+	}
+	int syms_cap = nfuncs + ctx->obj_calls_len + 1;
+	Elf64_Sym *syms = calloc(syms_cap, sizeof(Elf64_Sym));
+	Elf64_Rela *relas = calloc(ctx->obj_calls_len + 1, sizeof(Elf64_Rela));
+	uint32_t *undef_names = malloc(sizeof(uint32_t) * (ctx->obj_calls_len + 1));
+	if (!syms || !relas || !undef_names) {
+		error("メモリが足りません");
+	}
+	StrTab strtab = {0};
+	strtab_add(&strtab, "", 0);
+
+	int nsyms = 1;
+	for (int i = 0; ctx->code[i]; i++) {
+		Func *func = find_func(FUNC_NAME(ctx->code[i]));
+		Token *name = &ctx->tokens[func->name];
+		Elf64_Sym *sym = &syms[nsyms++];
+		sym->st_name = strtab_add(&strtab, name->str, name->len);
+		sym->st_info = ELF64_ST_INFO(STB_GLOBAL, STT_FUNC);
+		sym->st_shndx = SEC_TEXT;
+		sym->st_value = func->text_offset;
+		sym->st_size = func->text_size;
+	}
+
+	// 定義した関数への呼び出しは変位を埋め，それ以外は再配置にする
+	int nrelas = 0, nundefs = 0;
+	for (int i = 0; i < ctx->obj_calls_len; i++) {
+		ObjCall *call = &ctx->obj_calls[i];
+		if (patch_call(call)) {
+			continue;
+		}
+		Token *name = &ctx->tokens[call->name];
+
+		int sym = 0;
+		for (int j = 0; j < nundefs; j++) {
+			Token *t = &ctx->tokens[undef_names[j]];
+			if (t->len == name->len && !memcmp(t->str, name->str, name->len)) {
+				sym = nfuncs + 1 + j;
+				break;
+			}
+		}
+		if (!sym) {
+			sym = nsyms++;
+			undef_names[nundefs++] = call->name;
+			syms[sym].st_name = strtab_add(&strtab, name->str, name->len);
+			syms[sym].st_info = ELF64_ST_INFO(STB_GLOBAL, STT_NOTYPE);
+			syms[sym].st_shndx = SHN_UNDEF;
+		}
+
+		Elf64_Rela *rela = &relas[nrelas++];
+		rela->r_offset = call->offset;
+		rela->r_info = ELF64_R_INFO(sym, R_X86_64_PLT32);
+		rela->r_addend = -4;
+	}
+
+	StrTab shstrtab = {0};
+	int sec_name[NUM_SECS] = {0};
+	strtab_add(&shstrtab, "", 0);
+	for (int i = 1; i < NUM_SECS; i++) {
+		sec_name[i] = strtab_add(&shstrtab, sec_names[i], strlen(sec_names[i]));
+	}
+
+	// ヘッダ，.text，.rela.text，.symtab，.strtab，.shstrtab，セクションヘッダの順に並べる
+	Elf64_Shdr shdrs[NUM_SECS] = {0};
+	size_t pos = sizeof(Elf64_Ehdr);
+	shdrs[SEC_TEXT] = (Elf64_Shdr){
+		.sh_type = SHT_PROGBITS, .sh_flags = SHF_ALLOC | SHF_EXECINSTR,
+		.sh_offset = pos, .sh_size = ctx->text_len, .sh_addralign = 16,
+	};
+	pos += ctx->text_len;
+	pos += -pos & 7;
+	shdrs[SEC_RELA_TEXT] = (Elf64_Shdr){
+		.sh_type = SHT_RELA, .sh_flags = SHF_INFO_LINK, .sh_offset = pos,
+		.sh_size = sizeof(Elf64_Rela) * nrelas, .sh_link = SEC_SYMTAB, .sh_info = SEC_TEXT,
+		.sh_addralign = 8, .sh_entsize = sizeof(Elf64_Rela),
+	};
+	pos += sizeof(Elf64_Rela) * nrelas;
+	shdrs[SEC_SYMTAB] = (Elf64_Shdr){
+		.sh_type = SHT_SYMTAB, .sh_offset = pos, .sh_size = sizeof(Elf64_Sym) * nsyms,
+		.sh_link = SEC_STRTAB, .sh_info = 1, .sh_addralign = 8, .sh_entsize = sizeof(Elf64_Sym),
+	};
+	pos += sizeof(Elf64_Sym) * nsyms;
+	shdrs[SEC_STRTAB] = (Elf64_Shdr){
+		.sh_type = SHT_STRTAB, .sh_offset = pos, .sh_size = strtab.len, .sh_addralign = 1,
+	};
+	pos += strtab.len;
+	shdrs[SEC_SHSTRTAB] = (Elf64_Shdr){
+		.sh_type = SHT_STRTAB, .sh_offset = pos, .sh_size = shstrtab.len, .sh_addralign = 1,
+	};
+	pos += shstrtab.len;
+	shdrs[SEC_NOTE_STACK] = (Elf64_Shdr){
+		.sh_type = SHT_PROGBITS, .sh_offset = pos, .sh_addralign = 1,
+	};
+	for (int i = 1; i < NUM_SECS; i++) {
+		shdrs[i].sh_name = sec_name[i];
+	}
+	size_t shoff = pos + (-pos & 7);
+
+	Elf64_Ehdr ehdr = {
+		.e_ident = {ELFMAG0, ELFMAG1, ELFMAG2, ELFMAG3, ELFCLASS64, ELFDATA2LSB, EV_CURRENT, ELFOSABI_SYSV},
+		.e_type = ET_REL,
+		.e_machine = EM_X86_64,
+		.e_version = EV_CURRENT,
+		.e_shoff = shoff,
+		.e_ehsize = sizeof(Elf64_Ehdr),
+		.e_shentsize = sizeof(Elf64_Shdr),
+		.e_shnum = NUM_SECS,
+		.e_shstrndx = SEC_SHSTRTAB,
+	};
+
+	pos = 0;
+	emit_bytes(&ehdr, sizeof(ehdr));
+	pos += sizeof(ehdr);
+	emit_bytes(ctx->text, ctx->text_len);
+	pos += ctx->text_len;
+	emit_pad(&pos);
+	emit_bytes(relas, sizeof(Elf64_Rela) * nrelas);
+	emit_bytes(syms, sizeof(Elf64_Sym) * nsyms);
+	emit_bytes(strtab.data, strtab.len);
+	emit_bytes(shstrtab.data, shstrtab.len);
+	pos = shdrs[SEC_NOTE_STACK].sh_offset;
+	emit_pad(&pos);
+	emit_bytes(shdrs, sizeof(shdrs));
+
+	free(syms);
+	free(relas);
+	free(undef_names);
+	free(strtab.data);
+	free(shstrtab.data);
+}
@@ -0,0 +1,115 @@
+// emit.c
+// アセンブリの出力
+// 文脈の出力先(メモリ上のバッファ)に書き溜める．ファイルへの書き出しは呼び出し側で行う
+
+#include "9cc.h"
+
+// このスレッドの出力先．NULLなら文脈の出力先(ctx->out)に書く
+static _Thread_local OutBuf *emit_out;
+
+void emit_to(OutBuf *out) {
+	emit_out = out;
+}
+
+// 出力先にlenバイトを追加できるよう広げる
+static void reserve(OutBuf *out, size_t len) {
+	if (out->len + len > out->cap) {
+		out->cap = (out->len + len) * 2 > 4096 ? (out->len + len) * 2 : 4096;
+		out->data = realloc(out->data, out->cap);
+		if (!out->data) {
+			error("メモリが足りません");
+		}
+	}
+}
+
+// 書き込む出力先を返す．出力しないならNULL
+static OutBuf *target(size_t len) {
+	if (emit_out) {
+		return emit_out;
+	}
+	ctx->emit_total += len;
+	return ctx->out;
+}
+
+void emit_strn(char *s, size_t len) {
+	OutBuf *out = target(len);
+	if (!out) {
+		return;
+	}
+	reserve(out, len);
+	memcpy(out->data + out->len, s, len);
+	out->len += len;
+}
+
+void emit_char(char c) {
+	OutBuf *out = target(1);
+	if (!out) {
+		return;
+	}
+	reserve(out, 1);
+	out->data[out->len++] = c;
+}
+
+// 整数を10進で出力する
+void emit_int(long val) {
+	char buf[24];
+	char *p = buf + sizeof(buf);
+	unsigned long u = val < 0 ? -(unsigned long)val : val;
+
+	do {
+		*--p = '0' + u % 10;
+		u /= 10;
+	} while (u);
+	if (val < 0) {
+		*--p = '-';
+	}
+	emit_strn(p, buf + sizeof(buf) - p);
+}
+
+// printfと同様の書式で出力する
+// 対応する変換は%d, %ld, %s, %.*s, %%のみ
+void emit(char *fmt, ...) {
+	va_list ap;
+	va_start(ap, fmt);
+
+	char *p = fmt;
+	while (*p) {
+		char *q = p;
+		while (*q && *q != '%') {
+			q++;
+		}
+		if (q != p) {
+			emit_strn(p, q - p);
+		}
+		if (!*q) {
+			break;
+		}
+
+		q++;
+		if (*q == 'd') {
+			emit_int(va_arg(ap, int));
+		}
+		else if (q[0] == 'l' && q[1] == 'd') {
+			emit_int(va_arg(ap, long));
+			q++;
+		}
+		else if (*q == 's') {
+			char *s = va_arg(ap, char *);
+			emit_strn(s, strlen(s));
+		}
+		else if (q[0] == '.' && q[1] == '*' && q[2] == 's') {
+			int len = va_arg(ap, int);
+			emit_strn(va_arg(ap, char *), len);
+			q += 2;
+		}
+		else if (*q == '%') {
+			emit_char('%');
+		}
+		else {
+			error("emit: 未対応の書式です: %s", fmt);
+		}
+		p = q + 1;
+	}
+
+	va_end(ap);
+}
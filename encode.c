@@ -0,0 +1,405 @@
+// encode.c
+// 命令列の機械語への変換
+
+#include "9cc.h"
+
+#include <limits.h>
+
+// 組み立て中の命令の機械語(スレッドごと)
+static _Thread_local unsigned char ibuf[16];
+static _Thread_local int ibuf_len;
+
+static void byte(int b) {
+	ibuf[ibuf_len++] = b;
+}
+
+static void imm32(int64_t val) {
+	uint32_t u = val;
+	for (int i = 0; i < 4; i++) {
+		byte(u >> (i * 8));
+	}
+}
+
+static void imm64(int64_t val) {
+	uint64_t u = val;
+	for (int i = 0; i < 8; i++) {
+		byte(u >> (i * 8));
+	}
+}
+
+static bool fits_imm8(int64_t val) {
+	return val == (int8_t)val;
+}
+
+static bool fits_imm32(int64_t val) {
+	return val == (int32_t)val;
+}
+
+// REXプレフィックス
+// regはModRMのreg欄(またはオペコードに足すレジスタ)，rmはr/m欄のオペランド
+// byte_regが真なら8ビットのspl, bpl, sil, dilを使うのでREXを必ずつける
+static void rex(bool w, int reg, Operand *rm, bool byte_reg) {
+	int r = 0x40 | w << 3 | (reg >> 3) << 2;
+	if (rm->kind == OPD_REG) {
+		r |= rm->reg >> 3;
+		byte_reg = byte_reg && rm->reg >= 4;
+	}
+	else {
+		r |= rm->reg >> 3;
+		if (rm->scale) {
+			r |= (rm->index >> 3) << 1;
+		}
+		byte_reg = false;
+	}
+	if (r != 0x40 || byte_reg) {
+		byte(r);
+	}
+}
+
+// ModRM(とSIB，変位)
+static void modrm(int reg, Operand *rm) {
+	reg &= 7;
+	if (rm->kind == OPD_REG) {
+		byte(0xc0 | reg << 3 | (rm->reg & 7));
+		return;
+	}
+
+	// rbp, r13を基底にするときは変位を省けない
+	int base = rm->reg & 7;
+	int mod = 2;
+	if (rm->val == 0 && base != 5) {
+		mod = 0;
+	}
+	else if (fits_imm8(rm->val)) {
+		mod = 1;
+	}
+
+	// 添字があるか，基底がrsp, r12ならSIBを使う
+	if (rm->scale || base == 4) {
+		int ss = rm->scale == 8 ? 3 : rm->scale == 4 ? 2 : rm->scale == 2 ? 1 : 0;
+		int index = rm->scale ? rm->index & 7 : 4;
+		byte(mod << 6 | reg << 3 | 4);
+		byte(ss << 6 | index << 3 | base);
+	}
+	else {
+		byte(mod << 6 | reg << 3 | base);
+	}
+
+	if (mod == 1) {
+		byte(rm->val);
+	}
+	else if (mod == 2) {
+		imm32(rm->val);
+	}
+}
+
+// 64ビットの演算: REX.W，オペコード，ModRM
+static void op_rm(int opcode, int reg, Operand *rm) {
+	rex(true, reg, rm, false);
+	if (opcode > 0xff) {
+		byte(opcode >> 8);
+	}
+	byte(opcode);
+	modrm(reg, rm);
+}
+
+// add, and, sub, cmpの/digit
+static int alu_digit[] = {
+	[OP_ADD] = 0, [OP_AND] = 4, [OP_SUB] = 5, [OP_CMP] = 7,
+};
+
+// シフトの/digit
+static int shift_digit[] = {
+	[OP_SHL] = 4, [OP_SHR] = 5, [OP_SAR] = 7,
+};
+
+static void bad_operand(Inst *inst) {
+	error("機械語にできない命令です(%d)", inst->op);
+}
+
+// 命令を機械語にしてibufに組み立てる
+// longなら分岐をrel32で，そうでなければrel8で符号化する．relは分岐の変位
+static void encode(Inst *inst, bool long_jump, int rel) {
+	Operand *dst = &inst->dst;
+	Operand *src = &inst->src;
+	ibuf_len = 0;
+
+	switch (inst->op) {
+	case OP_LABEL:
+	case OP_FUNC:
+		return;
+	case OP_MOV:
+		if (src->kind == OPD_IMM) {
+			if (dst->kind == OPD_REG && src->val >= 0 && src->val <= UINT32_MAX) {
+				// 32ビットに書くと上位はゼロになる
+				rex(false, 0, dst, false);
+				byte(0xb8 + (dst->reg & 7));
+				imm32(src->val);
+			}
+			else if (fits_imm32(src->val)) {
+				op_rm(0xc7, 0, dst);
+				imm32(src->val);
+			}
+			else if (dst->kind == OPD_REG) {
+				rex(true, 0, dst, false);
+				byte(0xb8 + (dst->reg & 7));
+				imm64(src->val);
+			}
+			else {
+				bad_operand(inst);
+			}
+		}
+		else if (src->kind == OPD_REG) {
+			op_rm(0x89, src->reg, dst);
+		}
+		else if (dst->kind == OPD_REG) {
+			op_rm(0x8b, dst->reg, src);
+		}
+		else {
+			bad_operand(inst);
+		}
+		return;
+	case OP_MOVZB:
+		if (dst->kind != OPD_REG || src->kind != OPD_REG) {
+			bad_operand(inst);
+		}
+		op_rm(0x0fb6, dst->reg, src);
+		return;
+	case OP_LEA:
+		op_rm(0x8d, dst->reg, src);
+		return;
+	case OP_PUSH:
+	case OP_POP:
+		rex(false, 0, dst, false);
+		byte((inst->op == OP_PUSH ? 0x50 : 0x58) + (dst->reg & 7));
+		return;
+	case OP_ADD:
+	case OP_AND:
+	case OP_SUB:
+	case OP_CMP:
+		if (src->kind == OPD_IMM) {
+			if (!fits_imm32(src->val)) {
+				bad_operand(inst);
+			}
+			op_rm(fits_imm8(src->val) ? 0x83 : 0x81, alu_digit[inst->op], dst);
+			if (fits_imm8(src->val)) {
+				byte(src->val);
+			}
+			else {
+				imm32(src->val);
+			}
+		}
+		else if (src->kind == OPD_REG) {
+			op_rm(alu_digit[inst->op] * 8 + 1, src->reg, dst);
+		}
+		else if (dst->kind == OPD_REG) {
+			op_rm(alu_digit[inst->op] * 8 + 3, dst->reg, src);
+		}
+		else {
+			bad_operand(inst);
+		}
+		return;
+	case OP_IMUL:
+		if (src->kind == OPD_NONE) {
+			op_rm(0xf7, 5, dst);
+		}
+		else if (dst->kind != OPD_REG) {
+			bad_operand(inst);
+		}
+		else if (src->kind == OPD_IMM) {
+			// imul r, imm は imul r, r, imm
+			op_rm(fits_imm8(src->val) ? 0x6b : 0x69, dst->reg, dst);
+			if (fits_imm8(src->val)) {
+				byte(src->val);
+			}
+			else {
+				imm32(src->val);
+			}
+		}
+		else {
+			op_rm(0x0faf, dst->reg, src);
+		}
+		return;
+	case OP_NEG:
+		op_rm(0xf7, 3, dst);
+		return;
+	case OP_IDIV:
+		op_rm(0xf7, 7, dst);
+		return;
+	case OP_SHL:
+	case OP_SHR:
+	case OP_SAR:
+		if (src->val == 1) {
+			op_rm(0xd1, shift_digit[inst->op], dst);
+			return;
+		}
+		op_rm(0xc1, shift_digit[inst->op], dst);
+		byte(src->val);
+		return;
+	case OP_CQO:
+		byte(0x48);
+		byte(0x99);
+		return;
+	case OP_SETCC:
+		rex(false, 0, dst, true);
+		byte(0x0f);
+		byte(0x90 + inst->cc);
+		modrm(0, dst);
+		return;
+	case OP_JMP:
+	case OP_CALL:
+		if (dst->kind == OPD_SYM) {
+			// 変位は最後に埋めるか再配置にする
+			byte(inst->op == OP_CALL ? 0xe8 : 0xe9);
+			imm32(0);
+		}
+		else if (long_jump) {
+			byte(0xe9);
+			imm32(rel);
+		}
+		else {
+			byte(0xeb);
+			byte(rel);
+		}
+		return;
+	case OP_JCC:
+		if (long_jump) {
+			byte(0x0f);
+			byte(0x80 + inst->cc);
+			imm32(rel);
+		}
+		else {
+			byte(0x70 + inst->cc);
+			byte(rel);
+		}
+		return;
+	case OP_RET:
+		byte(0xc3);
+		return;
+	}
+	bad_operand(inst);
+}
+
+static bool is_label_jump(Inst *inst) {
+	return (inst->op == OP_JMP || inst->op == OP_JCC) && inst->dst.kind == OPD_LABEL;
+}
+
+static void add_text(unsigned char *p, int len) {
+	if (ctx->text_len + len > ctx->text_cap) {
+		ctx->text_cap = ctx->text_cap ? ctx->text_cap * 2 : 1 << 16;
+		ctx->text = realloc(ctx->text, ctx->text_cap);
+		if (!ctx->text) {
+			error("メモリが足りません");
+		}
+	}
+	memcpy(ctx->text + ctx->text_len, p, len);
+	ctx->text_len += len;
+}
+
+static void add_call(ObjCall **calls, int *len, int *cap, int offset, uint32_t name) {
+	if (*len == *cap) {
+		*cap = *cap ? *cap * 2 : 16;
+		*calls = realloc(*calls, sizeof(ObjCall) * *cap);
+		if (!*calls) {
+			error("メモリが足りません");
+		}
+	}
+	(*calls)[(*len)++] = (ObjCall){offset, name};
+}
+
+// 関数の機械語を.textの末尾に置き，関数の中の位置を.textの中の位置に直す
+void add_func_text(Func *func, char *buf, int len) {
+	int start = ctx->text_len;
+	add_text((unsigned char *)buf, len);
+	func->text_offset += start;
+	for (int i = 0; i < func->ncalls; i++) {
+		ObjCall *call = &func->calls[i];
+		add_call(&ctx->obj_calls, &ctx->obj_calls_len, &ctx->obj_calls_cap, start + call->offset, call->name);
+	}
+	free(func->calls);
+	func->calls = NULL;
+	func->ncalls = 0;
+}
+
+// 呼び出し先が定義した関数なら変位を埋めて真を返す
+bool patch_call(ObjCall *call) {
+	Func *func = find_func(&ctx->tokens[call->name]);
+	if (!func) {
+		return false;
+	}
+	int32_t rel = func->text_offset - (call->offset + 4);
+	memcpy(ctx->text + call->offset, &rel, 4);
+	return true;
+}
+
+// 生成中の関数の命令列を機械語にして出力する
+// 関数の位置と呼び出しの位置は関数の先頭からのものにし，add_func_textで.textの中の位置に直す
+// 分岐はまずすべてrel8とし，届かないものをrel32に広げて，変わらなくなるまで位置を求め直す
+void encode_insts() {
+	int min_label = INT_MAX, max_label = INT_MIN;
+	for (int i = 0; i < insts_len; i++) {
+		if (insts[i].op == OP_LABEL) {
+			int n = insts[i].dst.val;
+			min_label = n < min_label ? n : min_label;
+			max_label = n > max_label ? n : max_label;
+		}
+	}
+	int nlabels = min_label <= max_label ? max_label - min_label + 1 : 0;
+	int *label_offset = malloc(sizeof(int) * (nlabels + 1));
+	int *offset = malloc(sizeof(int) * (insts_len + 1));
+	bool *long_jump = calloc(insts_len + 1, sizeof(bool));
+	if (!label_offset || !offset || !long_jump) {
+		error("メモリが足りません");
+	}
+
+	bool changed = true;
+	while (changed) {
+		changed = false;
+		int pos = 0;
+		for (int i = 0; i < insts_len; i++) {
+			offset[i] = pos;
+			if (insts[i].op == OP_LABEL) {
+				label_offset[insts[i].dst.val - min_label] = pos;
+			}
+			encode(&insts[i], long_jump[i], 0);
+			pos += ibuf_len;
+		}
+		offset[insts_len] = pos;
+
+		for (int i = 0; i < insts_len; i++) {
+			if (is_label_jump(&insts[i]) && !long_jump[i]) {
+				int rel = label_offset[insts[i].dst.val - min_label] - offset[i + 1];
+				if (!fits_imm8(rel)) {
+					long_jump[i] = true;
+					changed = true;
+				}
+			}
+		}
+	}
+
+	Func *func = NULL;
+	int calls_cap = 0;
+	for (int i = 0; i < insts_len; i++) {
+		Inst *inst = &insts[i];
+		int rel = 0;
+		if (is_label_jump(inst)) {
+			rel = label_offset[inst->dst.val - min_label] - offset[i + 1];
+		}
+		encode(inst, long_jump[i], rel);
+		if (inst->op == OP_FUNC) {
+			func = find_func(&ctx->tokens[inst->dst.val]);
+			func->text_offset = offset[i];
+		}
+		if ((inst->op == OP_CALL || inst->op == OP_JMP) && inst->dst.kind == OPD_SYM) {
+			add_call(&func->calls, &func->ncalls, &calls_cap, offset[i] + 1, inst->dst.val);
+		}
+		emit_strn((char *)ibuf, ibuf_len);
+	}
+	if (func) {
+		func->text_size = offset[insts_len] - func->text_offset;
+	}
+
+	free(label_offset);
+	free(offset);
+	free(long_jump);
+}
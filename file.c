@@ -0,0 +1,112 @@
+// file.c
+// 入力ファイルの読み込みと出力ファイルへの書き出し
+
+#include "9cc.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// fdの中身を最後まで読む
+static bool read_fd(int fd, Input *in) {
+	size_t cap = 4096;
+	in->data = malloc(cap);
+	in->len = 0;
+	for (;;) {
+		if (!in->data) {
+			return false;
+		}
+		ssize_t n = read(fd, in->data + in->len, cap - in->len);
+		if (n < 0) {
+			free(in->data);
+			return false;
+		}
+		if (n == 0) {
+			return true;
+		}
+		in->len += n;
+		if (in->len == cap) {
+			cap *= 2;
+			char *data = realloc(in->data, cap);
+			if (!data) {
+				free(in->data);
+			}
+			in->data = data;
+		}
+	}
+}
+
+// 通常のファイルはmmapして，コピーせずにトークナイズする
+bool read_file(char *path, Input *in) {
+	*in = (Input){.name = path};
+	if (!strcmp(path, "-")) {
+		in->name = "<stdin>";
+		return read_fd(0, in);
+	}
+
+	int fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+	struct stat st;
+	bool ok = !fstat(fd, &st);
+	if (ok && S_ISREG(st.st_mode) && st.st_size > 0) {
+		in->data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		in->len = st.st_size;
+		in->mapped = in->data != MAP_FAILED;
+		ok = in->mapped;
+	}
+	else if (ok) {
+		ok = read_fd(fd, in);
+	}
+	close(fd);
+	return ok;
+}
+
+bool open_input(char *arg, Input *in) {
+	if (read_file(arg, in)) {
+		return true;
+	}
+	// 空白や{を含む引数はファイル名ではなくプログラムとみなす
+	// それ以外は名前を打ち間違えたファイルかもしれないので，読めなければエラーにする
+	if (errno != ENOENT && errno != ENOTDIR && errno != ENAMETOOLONG) {
+		return false;
+	}
+	if (!strpbrk(arg, " \t\n{")) {
+		return false;
+	}
+	*in = (Input){.data = arg, .len = strlen(arg)};
+	return true;
+}
+
+void close_input(Input *in) {
+	if (in->mapped) {
+		munmap(in->data, in->len);
+	}
+	else if (in->name) {
+		free(in->data);
+	}
+}
+
+bool write_all(int fd, char *p, size_t len) {
+	while (len > 0) {
+		ssize_t n = write(fd, p, len);
+		if (n < 0) {
+			return false;
+		}
+		p += n;
+		len -= n;
+	}
+	return true;
+}
+
+bool write_file(char *path, char *p, size_t len) {
+	int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0) {
+		return false;
+	}
+	bool ok = write_all(fd, p, len);
+	return !close(fd) && ok;
+}
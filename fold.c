@@ -0,0 +1,246 @@
+// fold.c
+// ASTの定数畳み込みと代数的な簡約
+
+#include "9cc.h"
+
+static bool is_num(NodeId node, int64_t val) {
+	return node_kind(node) == ND_NUM && NUM_VAL(node) == val;
+}
+
+// 副作用がない式なら真
+static bool is_pure(NodeId node) {
+	switch (node_kind(node)) {
+	case ND_NUM:
+	case ND_LVAR:
+	case ND_ADDR:
+		return true;
+	case ND_ASSIGN:
+	case ND_FUNCALL:
+		return false;
+	case ND_DEREF:
+		return is_pure(LHS(node));
+	default:
+		return is_pure(LHS(node)) && is_pure(RHS(node));
+	}
+}
+
+// 定数同士の演算を計算する
+// 結果がノードに収まらない，0で割るなど畳み込めないときは偽を返す
+static bool eval_binary(NodeKind kind, int64_t l, int64_t r, int64_t *val) {
+	switch (kind) {
+	case ND_ADD: *val = l + r; break;
+	case ND_SUB: *val = l - r; break;
+	case ND_MUL: *val = l * r; break;
+	case ND_DIV:
+		if (r == 0) {
+			return false;
+		}
+		*val = l / r;
+		break;
+	case ND_EQ: *val = l == r; break;
+	case ND_NEQ: *val = l != r; break;
+	case ND_LEQ: *val = l <= r; break;
+	case ND_LE: *val = l < r; break;
+	default:
+		return false;
+	}
+	return *val == (int32_t)*val;
+}
+
+static NodeId fold_expr(NodeId node);
+
+// 畳み込みの途中で新しいノードを作るとnode_poolが移動しうるので，
+// 結果は一旦変数に受けてから書き込む
+
+// 代入の左辺，単項&の被演算子は左辺値のまま残す
+static NodeId fold_lvalue(NodeId node) {
+	NodeId folded;
+
+	if (node_kind(node) == ND_DEREF) {
+		folded = fold_expr(LHS(node));
+		LHS(node) = folded;
+	}
+	return node;
+}
+
+// 二項演算を簡約する
+static NodeId fold_binary(NodeId node) {
+	NodeKind kind = node_kind(node);
+	NodeId lhs = fold_expr(LHS(node));
+	LHS(node) = lhs;
+	NodeId rhs = fold_expr(RHS(node));
+	RHS(node) = rhs;
+	int64_t val;
+
+	// 定数同士
+	if (node_kind(lhs) == ND_NUM && node_kind(rhs) == ND_NUM &&
+		eval_binary(kind, NUM_VAL(lhs), NUM_VAL(rhs), &val)) {
+		return new_node_num(val);
+	}
+
+	switch (kind) {
+	case ND_ADD:
+		// x+0, 0+x => x
+		if (is_num(rhs, 0)) return lhs;
+		if (is_num(lhs, 0)) return rhs;
+		// (x+c1)+c2 => x+(c1+c2)
+		if (node_kind(rhs) == ND_NUM && node_kind(lhs) == ND_ADD &&
+			node_kind(RHS(lhs)) == ND_NUM &&
+			eval_binary(ND_ADD, NUM_VAL(RHS(lhs)), NUM_VAL(rhs), &val)) {
+			return new_node(ND_ADD, LHS(lhs), new_node_num(val));
+		}
+		return node;
+	case ND_SUB:
+		// x-0 => x
+		if (is_num(rhs, 0)) return lhs;
+		// 0-(0-x) => x
+		if (is_num(lhs, 0) && node_kind(rhs) == ND_SUB && is_num(LHS(rhs), 0)) {
+			return RHS(rhs);
+		}
+		return node;
+	case ND_MUL:
+		// x*1, 1*x => x
+		if (is_num(rhs, 1)) return lhs;
+		if (is_num(lhs, 1)) return rhs;
+		// x*0, 0*x => 0 (xに副作用がなければ)
+		if ((is_num(rhs, 0) && is_pure(lhs)) || (is_num(lhs, 0) && is_pure(rhs))) {
+			return new_node_num(0);
+		}
+		return node;
+	case ND_DIV:
+		// x/1 => x
+		if (is_num(rhs, 1)) return lhs;
+		return node;
+	default:
+		return node;
+	}
+}
+
+// 式を簡約し，置き換えるノードを返す
+static NodeId fold_expr(NodeId node) {
+	NodeId folded;
+
+	switch (node_kind(node)) {
+	case ND_NUM:
+	case ND_LVAR:
+		return node;
+	case ND_ADDR:
+		folded = fold_lvalue(LHS(node));
+		LHS(node) = folded;
+		return node;
+	case ND_DEREF:
+		folded = fold_expr(LHS(node));
+		LHS(node) = folded;
+		return node;
+	case ND_ASSIGN:
+		folded = fold_lvalue(LHS(node));
+		LHS(node) = folded;
+		folded = fold_expr(RHS(node));
+		RHS(node) = folded;
+		return node;
+	case ND_FUNCALL:
+		for (int i = 0; i < node_count(node); i++) {
+			folded = fold_expr(CALL_ARG(node, i));
+			CALL_ARG(node, i) = folded;
+		}
+		return node;
+	default:
+		folded = fold_binary(node);
+		if (folded != node) {
+			ctx->fold_count++;
+		}
+		return folded;
+	}
+}
+
+// 文を簡約し，置き換えるノードを返す
+// 関数の末尾から抜けたときの返り値を変えないよう，
+// 定数になった条件式は式文として残す
+static NodeId fold_stmt(NodeId node) {
+	NodeId cond, folded, stmts[2];
+
+	switch (node_kind(node)) {
+	case ND_RETURN:
+		folded = fold_expr(LHS(node));
+		LHS(node) = folded;
+		return node;
+	case ND_IF:
+		cond = fold_expr(IF_COND(node));
+		IF_COND(node) = cond;
+		folded = fold_stmt(IF_THEN(node));
+		IF_THEN(node) = folded;
+		if (IF_ELSE(node)) {
+			folded = fold_stmt(IF_ELSE(node));
+			IF_ELSE(node) = folded;
+		}
+		if (node_kind(cond) != ND_NUM) {
+			return node;
+		}
+		ctx->fold_count++;
+		// if (c) A else B => {c; A}か{c; B}
+		stmts[0] = cond;
+		stmts[1] = NUM_VAL(cond) ? IF_THEN(node) : IF_ELSE(node);
+		return stmts[1] ? new_node_block(stmts, 2) : cond;
+	case ND_WHILE:
+		cond = fold_expr(WHILE_COND(node));
+		WHILE_COND(node) = cond;
+		folded = fold_stmt(WHILE_BODY(node));
+		WHILE_BODY(node) = folded;
+		if (node_kind(cond) != ND_NUM) {
+			return node;
+		}
+		ctx->fold_count++;
+		// while (0) A => 0
+		if (!NUM_VAL(cond)) {
+			return cond;
+		}
+		// while (c) A => 条件を調べずに繰り返す
+		WHILE_COND(node) = 0;
+		return node;
+	case ND_FOR:
+		if (FOR_INIT(node)) {
+			folded = fold_stmt(FOR_INIT(node));
+			FOR_INIT(node) = folded;
+		}
+		if (FOR_INC(node)) {
+			folded = fold_stmt(FOR_INC(node));
+			FOR_INC(node) = folded;
+		}
+		folded = fold_stmt(FOR_BODY(node));
+		FOR_BODY(node) = folded;
+		if (!FOR_COND(node)) {
+			return node;
+		}
+		cond = fold_expr(FOR_COND(node));
+		FOR_COND(node) = cond;
+		if (node_kind(cond) != ND_NUM) {
+			return node;
+		}
+		ctx->fold_count++;
+		// for (init; 0; inc) A => {init; 0}
+		if (!NUM_VAL(cond)) {
+			stmts[0] = FOR_INIT(node);
+			stmts[1] = cond;
+			return stmts[0] ? new_node_block(stmts, 2) : cond;
+		}
+		// for (init; c; inc) A => for (init; ; inc) A
+		FOR_COND(node) = 0;
+		return node;
+	case ND_BLOCK:
+		for (int i = 0; i < node_count(node); i++) {
+			folded = fold_stmt(BLOCK_STMT(node, i));
+			BLOCK_STMT(node, i) = folded;
+		}
+		return node;
+	default:
+		return fold_expr(node);
+	}
+}
+
+// codeの各関数を簡約する
+void fold() {
+	for (int i = 0; ctx->code[i]; i++) {
+		NodeId body = fold_stmt(FUNC_BODY(ctx->code[i]));
+		FUNC_BODY(ctx->code[i]) = body;
+	}
+}
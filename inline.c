@@ -0,0 +1,343 @@
+// inline.c
+// 小さな関数のインライン展開
+
+#include "9cc.h"
+
+// 展開した関数の返り値を持つ変数(中間表現の出力で使う名前)
+static LVar ret_lvar = {.name = "ret", .len = 3};
+
+// 関数の命令の個数(phiを除く)
+static int ir_size(IrFunc *fn) {
+	int n = 0;
+	for (IrBlock *b = fn->blocks; b; b = b->next) {
+		for (IrInst *inst = b->first; inst; inst = inst->next) {
+			if (inst->op != IR_PHI) {
+				n++;
+			}
+		}
+	}
+	return n;
+}
+
+// 展開する呼び出し先．展開しないならNULLを返す
+static Func *inline_callee(IrInst *call) {
+	Func *callee = find_func(&ctx->tokens[call->val]);
+	if (!callee || callee->inline_state != INLINE_DONE || callee->nparams != call->nargs) {
+		// 定義のない関数と再帰呼び出しは展開しない
+		return NULL;
+	}
+	if (ir_size(callee->ir) > ctx->inline_threshold) {
+		return NULL;
+	}
+	return callee;
+}
+
+// ブロックのsuccの前任ブロックをfromからtoに付け替える
+static void replace_pred(IrBlock *succ, IrBlock *from, IrBlock *to) {
+	for (int i = 0; i < succ->npreds; i++) {
+		if (succ->preds[i] == from) {
+			succ->preds[i] = to;
+		}
+	}
+}
+
+// 呼び出しcallのあるブロックを呼び出しの直後で分け，後半のブロックを返す
+static IrBlock *split_block(IrFunc *fn, IrInst *call) {
+	IrBlock *block = call->block;
+	IrBlock *cont = ir_new_block(fn, block);
+
+	cont->first = call->next;
+	cont->last = block->last;
+	for (IrInst *inst = cont->first; inst; inst = inst->next) {
+		inst->block = cont;
+	}
+	cont->first->prev = NULL;
+	block->last = call;
+	call->next = NULL;
+
+	for (int i = 0; i < 2; i++) {
+		cont->succ[i] = block->succ[i];
+		block->succ[i] = NULL;
+		if (cont->succ[i]) {
+			replace_pred(cont->succ[i], block, cont);
+		}
+	}
+	ir_remove(call);
+	return cont;
+}
+
+// 呼び出しcallを呼び出し先calleeの本体で置き換える
+// 呼び出し先の変数は呼び出し元の変数の後ろに番号を振り直し，
+// 返り値は新しい変数に代入して後半のブロックで合流させる
+static void inline_call(IrFunc *fn, IrInst *call, IrFunc *callee) {
+	// 変数の番号を振り直す(呼び出し先の変数vは呼び出し元のbase + v)
+	int base = fn->nvars - 1;
+	int ret_var = base + callee->nvars;
+	LVar **vars = arena_alloc(ir_arena, sizeof(LVar *) * (ret_var + 1));
+	memcpy(vars, fn->vars, sizeof(LVar *) * fn->nvars);
+	memcpy(vars + base + 1, callee->vars + 1, sizeof(LVar *) * (callee->nvars - 1));
+	vars[ret_var] = &ret_lvar;
+	fn->vars = vars;
+	fn->nvars = ret_var + 1;
+
+	// 呼び出しの値をそのまま返すなら，展開した本体から直接返す
+	// 本体の中の末尾呼び出しも末尾呼び出しのまま残る
+	bool tail = call->next && call->next->op == IR_RET && call->next->args[0] == call;
+
+	IrBlock *block = call->block;
+	IrBlock *cont = split_block(fn, call);
+
+	// 呼び出し先のブロックと値の対応
+	int nblocks = 0;
+	for (IrBlock *b = callee->blocks; b; b = b->next) {
+		b->mark = nblocks++;
+	}
+	IrBlock **bmap = malloc(sizeof(IrBlock *) * nblocks);
+	IrInst **vmap = calloc(callee->nvalues, sizeof(IrInst *));
+	if (!bmap || !vmap) {
+		error("メモリが足りません");
+	}
+
+	// 一度も代入されない引数の変数は実引数で置き換えられる
+	// 展開した部分では呼び出し元の変数を書き換えないので，実引数の値は変わらない
+	int *versions = calloc(callee->nvars, sizeof(int));
+	if (!versions) {
+		error("メモリが足りません");
+	}
+	for (IrBlock *b = callee->blocks; b; b = b->next) {
+		for (IrInst *inst = b->first; inst; inst = inst->next) {
+			versions[inst->var]++;
+		}
+	}
+
+	IrBlock *after = block;
+	for (IrBlock *b = callee->blocks; b; b = b->next) {
+		after = bmap[b->mark] = ir_new_block(fn, after);
+	}
+
+	// 命令を写す．phiは後ろの値を使うので，引数はすべて写してから埋める
+	IrInst *ret = NULL;
+	int nrets = 0;
+	for (IrBlock *b = callee->blocks; b; b = b->next) {
+		IrBlock *nb = bmap[b->mark];
+		for (IrInst *inst = b->first; inst; inst = inst->next) {
+			IrInst *copy;
+			switch (inst->op) {
+			case IR_PARAM:
+				if (!inst->var || versions[inst->var] == 1) {
+					vmap[inst->id] = call->args[inst->val];
+					continue;
+				}
+				copy = ir_new_inst(fn, IR_COPY, 1);
+				copy->args[0] = call->args[inst->val];
+				break;
+			case IR_RET:
+				if (tail) {
+					copy = ir_new_inst(fn, IR_RET, 1);
+					break;
+				}
+				// 返り値を変数に代入して後半のブロックへ進む
+				copy = ir_new_inst(fn, IR_COPY, 1);
+				copy->var = ret_var;
+				vmap[inst->id] = copy;
+				ir_append(nb, copy);
+				ret = copy;
+				nrets++;
+				ir_append(nb, ir_new_inst(fn, IR_JMP, 0));
+				nb->succ[0] = cont;
+				ir_add_pred(cont, nb);
+				continue;
+			default:
+				copy = ir_new_inst(fn, inst->op, inst->nargs);
+				copy->val = inst->val;
+				if (inst->op == IR_ADDR || inst->op == IR_LOADVAR || inst->op == IR_STOREVAR) {
+					copy->val = base + inst->val;
+				}
+			}
+			copy->var = inst->var ? base + inst->var : 0;
+			vmap[inst->id] = copy;
+			ir_append(nb, copy);
+		}
+
+		for (int i = 0; i < 2; i++) {
+			if (b->succ[i]) {
+				nb->succ[i] = bmap[b->succ[i]->mark];
+			}
+		}
+		for (int i = 0; i < b->npreds; i++) {
+			ir_add_pred(nb, bmap[b->preds[i]->mark]);
+		}
+	}
+
+	for (IrBlock *b = callee->blocks; b; b = b->next) {
+		for (IrInst *inst = b->first; inst; inst = inst->next) {
+			if (inst->op == IR_PARAM) {
+				continue;
+			}
+			IrInst *copy = vmap[inst->id];
+			for (int i = 0; i < inst->nargs; i++) {
+				IrInst *arg = inst->args[i];
+				copy->args[i] = arg->op == IR_IMM ? ir_imm(fn, arg->val) : vmap[arg->id];
+			}
+		}
+	}
+
+	// 呼び出しの値を返り値で置き換える(呼び出し元の引数はinline_irで付け替える)
+	// 返り値が呼び出し元の変数の値なら，後で書き換えられうるので変数に移したものを使う
+	IrInst *result;
+	if (nrets == 1) {
+		result = ret;
+		IrInst *val = ret->args[0];
+		if (val->op == IR_IMM || !val->var || val->var > base) {
+			result = val;
+			ir_remove(ret);
+		}
+	}
+	else {
+		// 直接返すか返らない関数なら，後半のブロックには到達しない
+		result = ir_new_inst(fn, nrets ? IR_PHI : IR_UNDEF, nrets);
+		result->var = ret_var;
+		for (int i = 0; i < nrets; i++) {
+			IrBlock *pred = cont->preds[i];
+			result->args[i] = pred->last->prev;
+		}
+		result->next = cont->first;
+		cont->first->prev = result;
+		cont->first = result;
+		result->block = cont;
+	}
+	call->repl = result;
+
+	// 前半のブロックから呼び出し先の入口へ進む
+	ir_append(block, ir_new_inst(fn, IR_JMP, 0));
+	block->succ[0] = bmap[0];
+	ir_add_pred(bmap[0], block);
+
+	ctx->inline_count++;
+	if (ctx->opt_inline_report) {
+		Token *caller_name = FUNC_NAME(fn->node);
+		Token *callee_name = FUNC_NAME(callee->node);
+		fprintf(stderr, "inline: %.*s into %.*s (%d instructions)\n",
+				callee_name->len, callee_name->str, caller_name->len, caller_name->str,
+				ir_size(callee));
+	}
+
+	free(bmap);
+	free(vmap);
+	free(versions);
+}
+
+// 中間表現を作っている途中の関数
+typedef struct {
+	Func *func;
+	IrFunc *fn;
+	IrInst **calls;		// 展開するか調べる呼び出し(展開した本体の中のものは含まない)
+	int ncalls;
+	int next;			// 次に調べる呼び出し
+	int inlined;
+} InlineFrame;
+
+// funcの中間表現を作り始める
+static void begin_inline(InlineFrame *f, Func *func) {
+	*f = (InlineFrame){.func = func};
+	func->inline_state = INLINE_ACTIVE;
+	f->fn = build_ir(func->node);
+	if (ctx->cache_dir) {
+		func->key = cache_key(func);
+	}
+	if (ctx->inline_threshold <= 0) {
+		return;
+	}
+
+	// 展開した本体の中の呼び出しは展開しないよう，先に呼び出しを集める
+	for (IrBlock *b = f->fn->blocks; b; b = b->next) {
+		for (IrInst *inst = b->first; inst; inst = inst->next) {
+			f->ncalls += inst->op == IR_CALL;
+		}
+	}
+	f->calls = malloc(sizeof(IrInst *) * (f->ncalls + 1));
+	if (!f->calls) {
+		error("メモリが足りません");
+	}
+	f->ncalls = 0;
+	for (IrBlock *b = f->fn->blocks; b; b = b->next) {
+		for (IrInst *inst = b->first; inst; inst = inst->next) {
+			if (inst->op == IR_CALL) {
+				f->calls[f->ncalls++] = inst;
+			}
+		}
+	}
+}
+
+// すべての呼び出しを調べ終えた関数を仕上げる
+static void finish_inline(InlineFrame *f) {
+	IrFunc *fn = f->fn;
+	free(f->calls);
+	if (f->inlined) {
+		// 展開した呼び出しの値を使う引数を付け替える
+		for (IrBlock *b = fn->blocks; b; b = b->next) {
+			for (IrInst *inst = b->first; inst; inst = inst->next) {
+				for (int i = 0; i < inst->nargs; i++) {
+					while (inst->args[i]->repl) {
+						inst->args[i] = inst->args[i]->repl;
+					}
+				}
+			}
+		}
+		remove_unreachable(fn);
+		merge_blocks(fn);
+	}
+	f->func->ir = fn;
+	f->func->inline_state = INLINE_DONE;
+}
+
+// 関数の中間表現を作り，呼び出している小さな関数を展開する
+// 呼び出し先は先に展開しておくので，展開した本体に同じ呼び出しは残らない
+// 呼び出しの連なりはいくらでも長くなりうるので，再帰せずに自前のスタックで呼び出し先へ降りる
+IrFunc *inline_ir(Func *func) {
+	if (func->ir) {
+		return func->ir;
+	}
+
+	int cap = 16, len = 1;
+	InlineFrame *stack = malloc(sizeof(InlineFrame) * cap);
+	if (!stack) {
+		error("メモリが足りません");
+	}
+	begin_inline(&stack[0], func);
+
+	while (len) {
+		InlineFrame *f = &stack[len - 1];
+		if (f->next == f->ncalls) {
+			finish_inline(f);
+			len--;
+			continue;
+		}
+
+		// 呼び出し先の中間表現がまだなければ，先に作る
+		IrInst *call = f->calls[f->next];
+		Func *callee = find_func(&ctx->tokens[call->val]);
+		if (callee && callee->inline_state == INLINE_NONE && callee->nparams == call->nargs) {
+			if (len == cap) {
+				cap *= 2;
+				stack = realloc(stack, sizeof(InlineFrame) * cap);
+				if (!stack) {
+					error("メモリが足りません");
+				}
+			}
+			begin_inline(&stack[len++], callee);
+			continue;
+		}
+
+		f->next++;
+		callee = inline_callee(call);
+		if (callee) {
+			// 展開した本体のコードも出力に入るので，キーに混ぜる
+			inline_call(f->fn, call, callee->ir);
+			f->func->key = cache_key_add(f->func->key, callee->key);
+			f->inlined++;
+		}
+	}
+	free(stack);
+	return func->ir;
+}
@@ -0,0 +1,1098 @@
+// ir.c
+// ASTからSSA形式の中間表現を作る
+
+#include "9cc.h"
+
+// 中間表現を確保するアリーナ．コード生成のスレッドはそれぞれ自分のものを使う
+_Thread_local Arena *ir_arena;
+
+// 作成中の関数
+static _Thread_local IrFunc *fn;
+
+// 命令を追加するブロック
+static _Thread_local IrBlock *cur;
+
+// 関数の末尾のブロック(新しいブロックはここにつなぐ)
+static _Thread_local IrBlock *tail;
+
+// 関数の末尾から抜けたときに返す値を持つ変数の番号
+static _Thread_local int last_var;
+
+// 変数ごとの現在の値(NULLならまだ代入されていない)
+static _Thread_local IrInst **cur_def;
+
+// 変数ごとの代入される前の値
+static _Thread_local IrInst **undef_def;
+
+// アドレスを取られた変数．SSAにせず，読み書きのたびにメモリを使う
+static _Thread_local bool *addr_taken;
+
+// 変数の重複を除くための印と，合流で使う値
+static _Thread_local int *var_mark;
+static _Thread_local int mark_gen;
+static _Thread_local IrInst **arm_def;
+
+static _Thread_local int vars_cap;
+
+// cur_defの変更の記録
+// 分岐の合流で，分岐先で変更された変数を求めるのに使う
+typedef struct {
+	int var;
+	IrInst *old;	// 変更前の値．合流で使うときは変更後の値
+} DefLog;
+
+static _Thread_local DefLog *def_log;
+static _Thread_local int def_log_len, def_log_cap;
+
+// Sethi-Ullmanの番号
+// ノードの値を求めるのに必要な一時的な値の個数
+static int su_label(NodeId node) {
+	if (ctx->su_cache[node]) {
+		return ctx->su_cache[node];
+	}
+
+	int n, l, r;
+	switch (node_kind(node)) {
+	case ND_NUM:
+	case ND_LVAR:
+	case ND_ADDR:
+		n = 1;
+		break;
+	case ND_DEREF:
+		n = su_label(LHS(node));
+		break;
+	case ND_ASSIGN:
+		n = su_label(RHS(node));
+		break;
+	case ND_FUNCALL:
+		// i番目の引数はi個の値を持ったまま評価する
+		n = 1;
+		for (int i = 0; i < node_count(node); i++) {
+			if (su_label(CALL_ARG(node, i)) + i > n) {
+				n = su_label(CALL_ARG(node, i)) + i;
+			}
+		}
+		break;
+	default:
+		l = su_label(LHS(node));
+		r = su_label(RHS(node));
+		n = l == r ? l + 1 : (l > r ? l : r);
+	}
+
+	if (n > 255) {
+		n = 255;
+	}
+	return ctx->su_cache[node] = n;
+}
+
+// ブロックの番号は関数ごとに振る(ラベルには関数名をつける)
+static IrBlock *alloc_block(IrFunc *f) {
+	IrBlock *block = arena_alloc(ir_arena, sizeof(IrBlock));
+	block->id = f->nblocks++;
+	ctx->ir_blocks_total++;
+	return block;
+}
+
+static IrBlock *new_block() {
+	IrBlock *block = alloc_block(fn);
+	tail->next = block;
+	tail = block;
+	return block;
+}
+
+static IrInst *new_inst(IrFunc *f, IrOp op, int nargs) {
+	IrInst *inst = arena_alloc(ir_arena, sizeof(IrInst));
+	inst->op = op;
+	inst->id = f->nvalues++;
+	inst->nargs = nargs;
+	inst->args = nargs <= 2 ? inst->inline_args : arena_alloc(ir_arena, sizeof(IrInst *) * nargs);
+	ctx->ir_values_total++;
+	return inst;
+}
+
+// 定数の値を作る
+IrInst *ir_imm(IrFunc *f, int64_t val) {
+	IrInst *inst = new_inst(f, IR_IMM, 0);
+	inst->val = val;
+	return inst;
+}
+
+IrInst *ir_new_inst(IrFunc *f, IrOp op, int nargs) {
+	return new_inst(f, op, nargs);
+}
+
+IrBlock *ir_new_block(IrFunc *f, IrBlock *after) {
+	IrBlock *block = alloc_block(f);
+	block->next = after->next;
+	after->next = block;
+	return block;
+}
+
+// 命令をブロックの末尾に追加する
+static void append(IrBlock *block, IrInst *inst) {
+	inst->block = block;
+	inst->prev = block->last;
+	if (block->last) {
+		block->last->next = inst;
+	}
+	else {
+		block->first = inst;
+	}
+	block->last = inst;
+}
+
+// 命令をブロックの先頭に追加する
+static void prepend(IrBlock *block, IrInst *inst) {
+	inst->block = block;
+	inst->next = block->first;
+	if (block->first) {
+		block->first->prev = inst;
+	}
+	else {
+		block->last = inst;
+	}
+	block->first = inst;
+}
+
+// 命令をブロックから外す
+void ir_remove(IrInst *inst) {
+	IrBlock *block = inst->block;
+	if (inst->prev) {
+		inst->prev->next = inst->next;
+	}
+	else {
+		block->first = inst->next;
+	}
+	if (inst->next) {
+		inst->next->prev = inst->prev;
+	}
+	else {
+		block->last = inst->prev;
+	}
+	inst->block = NULL;
+	inst->prev = inst->next = NULL;
+}
+
+void ir_append(IrBlock *block, IrInst *inst) {
+	append(block, inst);
+}
+
+static IrInst *emit_inst(IrOp op, int nargs) {
+	IrInst *inst = new_inst(fn, op, nargs);
+	append(cur, inst);
+	return inst;
+}
+
+static IrInst *emit_unary(IrOp op, IrInst *arg) {
+	IrInst *inst = emit_inst(op, 1);
+	inst->args[0] = arg;
+	return inst;
+}
+
+static IrInst *emit_binary(IrOp op, IrInst *lhs, IrInst *rhs) {
+	IrInst *inst = emit_inst(op, 2);
+	inst->args[0] = lhs;
+	inst->args[1] = rhs;
+	return inst;
+}
+
+static void add_pred(IrBlock *block, IrBlock *pred) {
+	if (block->npreds == block->preds_cap) {
+		block->preds_cap = block->preds_cap ? block->preds_cap * 2 : 2;
+		IrBlock **preds = arena_alloc(ir_arena, sizeof(IrBlock *) * block->preds_cap);
+		if (block->npreds) {
+			memcpy(preds, block->preds, sizeof(IrBlock *) * block->npreds);
+		}
+		block->preds = preds;
+	}
+	block->preds[block->npreds++] = pred;
+}
+
+void ir_add_pred(IrBlock *block, IrBlock *pred) {
+	add_pred(block, pred);
+}
+
+// 現在のブロックをtoへのジャンプで終える
+static void jump(IrBlock *to) {
+	emit_inst(IR_JMP, 0);
+	cur->succ[0] = to;
+	add_pred(to, cur);
+}
+
+// 現在のブロックを条件分岐で終える
+static void branch(IrInst *cond, IrBlock *then, IrBlock *els) {
+	emit_unary(IR_BR, cond);
+	cur->succ[0] = then;
+	cur->succ[1] = els;
+	add_pred(then, cur);
+	add_pred(els, cur);
+}
+
+// -- 変数 --
+
+static void write_var(int var, IrInst *val) {
+	if (def_log_len == def_log_cap) {
+		def_log_cap = def_log_cap ? def_log_cap * 2 : 256;
+		def_log = realloc(def_log, sizeof(DefLog) * def_log_cap);
+		if (!def_log) {
+			error("メモリが足りません");
+		}
+	}
+	def_log[def_log_len++] = (DefLog){var, cur_def[var]};
+	cur_def[var] = val;
+}
+
+static IrInst *read_var(int var) {
+	if (cur_def[var]) {
+		return cur_def[var];
+	}
+	if (!undef_def[var]) {
+		IrInst *inst = new_inst(fn, IR_UNDEF, 0);
+		inst->var = var;
+		prepend(fn->blocks, inst);
+		undef_def[var] = inst;
+	}
+	return undef_def[var];
+}
+
+// 変数に値を代入する
+static void assign_var(int var, IrInst *val) {
+	IrInst *inst = emit_unary(IR_COPY, val);
+	inst->var = var;
+	write_var(var, inst);
+}
+
+// 記録のmark以降に変更された変数とその現在の値を集め，変更を取り消す
+static DefLog *take_defs(int mark, int *n) {
+	DefLog *defs = arena_alloc(ir_arena, sizeof(DefLog) * (def_log_len - mark + 1));
+	int gen = ++mark_gen;
+
+	*n = 0;
+	for (int i = mark; i < def_log_len; i++) {
+		int var = def_log[i].var;
+		if (var_mark[var] != gen) {
+			var_mark[var] = gen;
+			defs[(*n)++] = (DefLog){var, cur_def[var]};
+		}
+	}
+	for (int i = def_log_len - 1; i >= mark; i--) {
+		cur_def[def_log[i].var] = def_log[i].old;
+	}
+	def_log_len = mark;
+	return defs;
+}
+
+// 2つの値を合流させる．異なればjoinにphiを作る
+static IrInst *join_values(IrBlock *join, int var, IrInst *v0, IrInst *v1) {
+	if (v0 == v1) {
+		return v0;
+	}
+	IrInst *phi = new_inst(fn, IR_PHI, 2);
+	phi->var = var;
+	phi->args[0] = v0;
+	phi->args[1] = v1;
+	prepend(join, phi);
+	return phi;
+}
+
+// 2つの前任ブロックからjoinに合流する
+// defs0, defs1はそれぞれの前任ブロックの末尾で，分岐前から変わった変数の値
+static void merge(IrBlock *join, DefLog *defs0, int n0, DefLog *defs1, int n1) {
+	int gen0 = ++mark_gen;
+	for (int i = 0; i < n0; i++) {
+		var_mark[defs0[i].var] = gen0;
+		arm_def[defs0[i].var] = defs0[i].old;
+	}
+
+	int gen1 = ++mark_gen;
+	for (int i = 0; i < n1; i++) {
+		int var = defs1[i].var;
+		IrInst *v0 = var_mark[var] == gen0 ? arm_def[var] : read_var(var);
+		var_mark[var] = gen1;
+		write_var(var, join_values(join, var, v0, defs1[i].old));
+	}
+	for (int i = 0; i < n0; i++) {
+		int var = defs0[i].var;
+		if (var_mark[var] != gen1) {
+			write_var(var, join_values(join, var, defs0[i].old, read_var(var)));
+		}
+	}
+}
+
+// 式と文の中で代入される変数に印をつける
+static void mark_assigned(NodeId node, int gen) {
+	if (!node) {
+		return;
+	}
+
+	switch (node_kind(node)) {
+	case ND_NUM:
+	case ND_LVAR:
+	case ND_ADDR:
+		return;
+	case ND_ASSIGN:
+		if (node_kind(LHS(node)) == ND_LVAR) {
+			var_mark[LVAR_OFFSET(LHS(node)) / 8] = gen;
+		}
+		mark_assigned(RHS(node), gen);
+		return;
+	case ND_DEREF:
+	case ND_RETURN:
+		mark_assigned(LHS(node), gen);
+		return;
+	case ND_IF:
+		mark_assigned(IF_COND(node), gen);
+		mark_assigned(IF_THEN(node), gen);
+		mark_assigned(IF_ELSE(node), gen);
+		return;
+	case ND_WHILE:
+		mark_assigned(WHILE_COND(node), gen);
+		mark_assigned(WHILE_BODY(node), gen);
+		return;
+	case ND_FOR:
+		mark_assigned(FOR_INIT(node), gen);
+		mark_assigned(FOR_COND(node), gen);
+		mark_assigned(FOR_INC(node), gen);
+		mark_assigned(FOR_BODY(node), gen);
+		return;
+	case ND_BLOCK:
+		for (int i = 0; i < node_count(node); i++) {
+			mark_assigned(BLOCK_STMT(node, i), gen);
+		}
+		return;
+	case ND_FUNCALL:
+		for (int i = 0; i < node_count(node); i++) {
+			mark_assigned(CALL_ARG(node, i), gen);
+		}
+		return;
+	default:
+		mark_assigned(LHS(node), gen);
+		mark_assigned(RHS(node), gen);
+	}
+}
+
+// アドレスを取られる変数を求める
+static void find_addr_taken(NodeId node) {
+	if (!node) {
+		return;
+	}
+
+	switch (node_kind(node)) {
+	case ND_NUM:
+	case ND_LVAR:
+		return;
+	case ND_ADDR:
+		if (node_kind(LHS(node)) != ND_LVAR) {
+			error("代入の左辺値が不正です");
+		}
+		addr_taken[LVAR_OFFSET(LHS(node)) / 8] = true;
+		return;
+	case ND_DEREF:
+	case ND_RETURN:
+		find_addr_taken(LHS(node));
+		return;
+	case ND_IF:
+		find_addr_taken(IF_COND(node));
+		find_addr_taken(IF_THEN(node));
+		find_addr_taken(IF_ELSE(node));
+		return;
+	case ND_WHILE:
+		find_addr_taken(WHILE_COND(node));
+		find_addr_taken(WHILE_BODY(node));
+		return;
+	case ND_FOR:
+		find_addr_taken(FOR_INIT(node));
+		find_addr_taken(FOR_COND(node));
+		find_addr_taken(FOR_INC(node));
+		find_addr_taken(FOR_BODY(node));
+		return;
+	case ND_BLOCK:
+		for (int i = 0; i < node_count(node); i++) {
+			find_addr_taken(BLOCK_STMT(node, i));
+		}
+		return;
+	case ND_FUNCALL:
+		for (int i = 0; i < node_count(node); i++) {
+			find_addr_taken(CALL_ARG(node, i));
+		}
+		return;
+	default:
+		find_addr_taken(LHS(node));
+		find_addr_taken(RHS(node));
+	}
+}
+
+// -- 式と文 --
+
+static IrInst *gen_expr(NodeId node);
+static void gen_stmt(NodeId node);
+
+static IrOp binary_ops[] = {
+	[ND_ADD] = IR_ADD, [ND_SUB] = IR_SUB, [ND_MUL] = IR_MUL, [ND_DIV] = IR_DIV,
+	[ND_EQ] = IR_EQ, [ND_NEQ] = IR_NE, [ND_LE] = IR_LT, [ND_LEQ] = IR_LE,
+};
+
+// 二項演算
+// 必要な一時的な値の多い方の子を先に評価する
+static IrInst *gen_binary(NodeId node) {
+	NodeId lhs = LHS(node), rhs = RHS(node);
+	IrInst *l, *r;
+
+	if (su_label(rhs) > su_label(lhs)) {
+		r = gen_expr(rhs);
+		l = gen_expr(lhs);
+	}
+	else {
+		l = gen_expr(lhs);
+		r = gen_expr(rhs);
+	}
+	return emit_binary(binary_ops[node_kind(node)], l, r);
+}
+
+static IrInst *gen_funcall(NodeId node) {
+	int n = node_count(node);
+	IrInst **args = n ? arena_alloc(ir_arena, sizeof(IrInst *) * n) : NULL;
+
+	for (int i = 0; i < n; i++) {
+		args[i] = gen_expr(CALL_ARG(node, i));
+	}
+
+	IrInst *inst = emit_inst(IR_CALL, n);
+	inst->val = ctx->node_pool[node + 1];
+	for (int i = 0; i < n; i++) {
+		inst->args[i] = args[i];
+	}
+	return inst;
+}
+
+// 代入の左辺の変数の番号
+static int lval_var(NodeId node) {
+	if (node_kind(node) != ND_LVAR) {
+		error("代入の左辺値が不正です");
+	}
+	return LVAR_OFFSET(node) / 8;
+}
+
+static IrInst *gen_expr(NodeId node) {
+	IrInst *val, *inst;
+	int var;
+
+	switch (node_kind(node)) {
+	case ND_NUM:
+		return ir_imm(fn, NUM_VAL(node));
+	case ND_LVAR:
+		var = LVAR_OFFSET(node) / 8;
+		if (addr_taken[var]) {
+			inst = emit_inst(IR_LOADVAR, 0);
+			inst->val = var;
+			return inst;
+		}
+		return read_var(var);
+	case ND_ASSIGN:
+		var = lval_var(LHS(node));
+		val = gen_expr(RHS(node));
+		if (addr_taken[var]) {
+			inst = emit_unary(IR_STOREVAR, val);
+			inst->val = var;
+		}
+		else {
+			assign_var(var, val);
+		}
+		return val;
+	case ND_FUNCALL:
+		return gen_funcall(node);
+	case ND_ADDR:
+		inst = emit_inst(IR_ADDR, 0);
+		inst->val = lval_var(LHS(node));
+		return inst;
+	case ND_DEREF:
+		return emit_unary(IR_LOAD, gen_expr(LHS(node)));
+	default:
+		return gen_binary(node);
+	}
+}
+
+// 条件式の値を求める
+// 関数の末尾から抜けたときのために，返す値として覚えておく
+static IrInst *gen_cond(NodeId node) {
+	IrInst *cond = gen_expr(node);
+	assign_var(last_var, cond);
+	return cond;
+}
+
+static void gen_if(NodeId node) {
+	IrInst *cond = gen_cond(IF_COND(node));
+	IrBlock *then = new_block();
+	IrBlock *els = IF_ELSE(node) ? new_block() : NULL;
+	IrBlock *join = new_block();
+	DefLog *defs0, *defs1;
+	int n0, n1;
+	int mark = def_log_len;
+
+	if (!els) {
+		// 前任ブロックは条件を調べたブロック，then節の末尾の順
+		branch(cond, then, join);
+		cur = then;
+		gen_stmt(IF_THEN(node));
+		jump(join);
+		defs1 = take_defs(mark, &n1);
+		merge(join, NULL, 0, defs1, n1);
+		cur = join;
+		return;
+	}
+
+	branch(cond, then, els);
+	cur = then;
+	gen_stmt(IF_THEN(node));
+	jump(join);
+	defs0 = take_defs(mark, &n0);
+
+	cur = els;
+	gen_stmt(IF_ELSE(node));
+	jump(join);
+	defs1 = take_defs(mark, &n1);
+
+	merge(join, defs0, n0, defs1, n1);
+	cur = join;
+}
+
+// while文とfor文
+// 前任ブロックは，ループの前，ループの末尾の順
+static void gen_loop(NodeId cond_node, NodeId body, NodeId inc) {
+	IrBlock *header = new_block();
+	jump(header);
+	cur = header;
+
+	// ループの中で代入される変数について，先頭にphiを置いておく
+	int gen = ++mark_gen;
+	mark_assigned(cond_node, gen);
+	mark_assigned(body, gen);
+	mark_assigned(inc, gen);
+	var_mark[last_var] = gen;
+
+	int nphis = 0;
+	for (int var = 1; var <= last_var; var++) {
+		if (var_mark[var] == gen && !addr_taken[var]) {
+			IrInst *phi = new_inst(fn, IR_PHI, 2);
+			phi->var = var;
+			phi->nargs = 1;
+			phi->args[0] = read_var(var);
+			append(header, phi);
+			write_var(var, phi);
+			nphis++;
+		}
+	}
+
+	IrBlock *body_block = new_block();
+	IrBlock *exit = new_block();
+	if (cond_node) {
+		branch(gen_cond(cond_node), body_block, exit);
+	}
+	else {
+		jump(body_block);
+	}
+
+	// ループを抜けるときの変数の値
+	IrInst **exit_defs = arena_alloc(ir_arena, sizeof(IrInst *) * (nphis + 1));
+	IrInst *phi = header->first;
+	for (int i = 0; i < nphis; i++, phi = phi->next) {
+		exit_defs[i] = cur_def[phi->var];
+	}
+
+	cur = body_block;
+	gen_stmt(body);
+	if (inc) {
+		gen_stmt(inc);
+	}
+	jump(header);
+
+	phi = header->first;
+	for (int i = 0; i < nphis; i++, phi = phi->next) {
+		phi->args[phi->nargs++] = read_var(phi->var);
+	}
+
+	cur = exit;
+	phi = header->first;
+	for (int i = 0; i < nphis; i++, phi = phi->next) {
+		write_var(phi->var, exit_defs[i]);
+	}
+}
+
+static void gen_stmt(NodeId node) {
+	switch (node_kind(node)) {
+	case ND_RETURN:
+		emit_unary(IR_RET, gen_expr(LHS(node)));
+		// 後に続く文は到達できないブロックに置く
+		cur = new_block();
+		return;
+	case ND_IF:
+		gen_if(node);
+		return;
+	case ND_WHILE:
+		gen_loop(WHILE_COND(node), WHILE_BODY(node), 0);
+		return;
+	case ND_FOR:
+		if (FOR_INIT(node)) {
+			gen_stmt(FOR_INIT(node));
+		}
+		gen_loop(FOR_COND(node), FOR_BODY(node), FOR_INC(node));
+		return;
+	case ND_BLOCK:
+		for (int i = 0; i < node_count(node); i++) {
+			gen_stmt(BLOCK_STMT(node, i));
+		}
+		return;
+	default:
+		// 関数の末尾から抜けたときに返す値として覚えておく
+		assign_var(last_var, gen_expr(node));
+	}
+}
+
+// 変数ごとの表を確保する
+static void alloc_var_tables(int nvars) {
+	if (nvars > vars_cap) {
+		vars_cap = nvars;
+		cur_def = realloc(cur_def, sizeof(IrInst *) * nvars);
+		undef_def = realloc(undef_def, sizeof(IrInst *) * nvars);
+		arm_def = realloc(arm_def, sizeof(IrInst *) * nvars);
+		addr_taken = realloc(addr_taken, sizeof(bool) * nvars);
+		var_mark = realloc(var_mark, sizeof(int) * nvars);
+		if (!cur_def || !undef_def || !arm_def || !addr_taken || !var_mark) {
+			error("メモリが足りません");
+		}
+	}
+	memset(cur_def, 0, sizeof(IrInst *) * nvars);
+	memset(undef_def, 0, sizeof(IrInst *) * nvars);
+	memset(addr_taken, 0, sizeof(bool) * nvars);
+	memset(var_mark, 0, sizeof(int) * nvars);
+	mark_gen = 0;
+	def_log_len = 0;
+}
+
+// 関数ノードから中間表現を作る
+IrFunc *build_ir(NodeId node) {
+	if (ctx->su_cache_len != ctx->node_pool_len) {
+		free(ctx->su_cache);
+		ctx->su_cache_len = ctx->node_pool_len;
+		ctx->su_cache = calloc(ctx->su_cache_len, 1);
+		if (!ctx->su_cache) {
+			error("メモリが足りません");
+		}
+	}
+
+	Func *func = find_func(FUNC_NAME(node));
+
+	fn = arena_alloc(ir_arena, sizeof(IrFunc));
+	fn->node = node;
+
+	// 変数の番号はオフセット / 8 で，末尾に返す値の変数を加える
+	last_var = (func->locals ? func->locals->offset / 8 : 0) + 1;
+	fn->nvars = last_var + 1;
+	fn->vars = arena_alloc(ir_arena, sizeof(LVar *) * fn->nvars);
+	for (LVar *var = func->locals; var; var = var->next) {
+		fn->vars[var->offset / 8] = var;
+	}
+
+	alloc_var_tables(fn->nvars);
+	find_addr_taken(FUNC_BODY(node));
+
+	IrBlock head = {0};
+	tail = &head;
+	fn->blocks = cur = new_block();
+
+	for (int i = 0; i < node_count(node); i++) {
+		int var = FUNC_PARAM(node, i) / 8;
+		IrInst *param = emit_inst(IR_PARAM, 0);
+		param->val = i;
+		if (addr_taken[var]) {
+			emit_unary(IR_STOREVAR, param)->val = var;
+		}
+		else {
+			param->var = var;
+			write_var(var, param);
+		}
+	}
+
+	gen_stmt(FUNC_BODY(node));
+
+	// 最後に評価した式の値を返す
+	IrInst *ret = emit_inst(IR_RET, 1);
+	ret->args[0] = read_var(last_var);
+
+	remove_unreachable(fn);
+	simplify_phis(fn);
+	return fn;
+}
+
+// -- 中間表現の整理 --
+
+// 入口から辿れないブロックを消す
+void remove_unreachable(IrFunc *f) {
+	for (IrBlock *b = f->blocks; b; b = b->next) {
+		b->mark = 0;
+	}
+
+	// 深さ優先で辿る
+	int cap = 64, len = 0;
+	IrBlock **stack = malloc(sizeof(IrBlock *) * cap);
+	if (!stack) {
+		error("メモリが足りません");
+	}
+	f->blocks->mark = 1;
+	stack[len++] = f->blocks;
+	while (len) {
+		IrBlock *b = stack[--len];
+		for (int i = 0; i < 2; i++) {
+			IrBlock *s = b->succ[i];
+			if (!s || s->mark) {
+				continue;
+			}
+			s->mark = 1;
+			if (len == cap) {
+				cap *= 2;
+				stack = realloc(stack, sizeof(IrBlock *) * cap);
+				if (!stack) {
+					error("メモリが足りません");
+				}
+			}
+			stack[len++] = s;
+		}
+	}
+	free(stack);
+
+	// 到達できない前任ブロックとphiの引数を除く
+	IrBlock *prev = NULL;
+	for (IrBlock *b = f->blocks; b; b = b->next) {
+		if (!b->mark) {
+			prev->next = b->next;
+			continue;
+		}
+		int n = 0;
+		for (int i = 0; i < b->npreds; i++) {
+			if (!b->preds[i]->mark) {
+				continue;
+			}
+			for (IrInst *phi = b->first; phi && phi->op == IR_PHI; phi = phi->next) {
+				phi->args[n] = phi->args[i];
+			}
+			b->preds[n++] = b->preds[i];
+		}
+		b->npreds = n;
+		for (IrInst *phi = b->first; phi && phi->op == IR_PHI; phi = phi->next) {
+			phi->nargs = n;
+		}
+		prev = b;
+	}
+}
+
+// 無条件ジャンプで前のブロックからしか来ないブロックを，前のブロックにつなげる
+void merge_blocks(IrFunc *f) {
+	bool merged = false;
+
+	for (IrBlock *b = f->blocks; b; b = b->next) {
+		if (!b->first) {
+			continue;
+		}
+		IrBlock *s;
+		while (b->last->op == IR_JMP && (s = b->succ[0]) != b && s != f->blocks &&
+			   s->npreds == 1 && s->first->op != IR_PHI) {
+			ir_remove(b->last);
+			for (IrInst *inst = s->first; inst; inst = inst->next) {
+				inst->block = b;
+			}
+			if (b->last) {
+				b->last->next = s->first;
+				s->first->prev = b->last;
+			}
+			else {
+				b->first = s->first;
+			}
+			b->last = s->last;
+
+			for (int i = 0; i < 2; i++) {
+				b->succ[i] = s->succ[i];
+				if (s->succ[i]) {
+					for (int j = 0; j < s->succ[i]->npreds; j++) {
+						if (s->succ[i]->preds[j] == s) {
+							s->succ[i]->preds[j] = b;
+						}
+					}
+				}
+			}
+
+			// 空になったsは後でブロックの列から外す
+			s->first = s->last = NULL;
+			merged = true;
+		}
+	}
+
+	if (!merged) {
+		return;
+	}
+	IrBlock *prev = f->blocks;
+	for (IrBlock *b = prev->next; b; b = b->next) {
+		if (b->first) {
+			prev->next = b;
+			prev = b;
+		}
+	}
+	prev->next = NULL;
+}
+
+// 置き換え先を辿る
+static IrInst *resolve(IrInst *inst) {
+	while (inst->repl) {
+		inst = inst->repl;
+	}
+	return inst;
+}
+
+// 引数がすべて同じ値(か自分自身)のphiを消し，その値で置き換える
+void simplify_phis(IrFunc *f) {
+	bool changed = true;
+	bool removed = false;
+
+	while (changed) {
+		changed = false;
+		for (IrBlock *b = f->blocks; b; b = b->next) {
+			IrInst *next;
+			for (IrInst *phi = b->first; phi && phi->op == IR_PHI; phi = next) {
+				next = phi->next;
+				IrInst *same = NULL;
+				bool trivial = true;
+				for (int i = 0; i < phi->nargs; i++) {
+					IrInst *arg = resolve(phi->args[i]);
+					if (arg == phi || arg == same) {
+						continue;
+					}
+					if (same) {
+						trivial = false;
+						break;
+					}
+					same = arg;
+				}
+				if (trivial && same) {
+					phi->repl = same;
+					ir_remove(phi);
+					changed = removed = true;
+				}
+			}
+		}
+	}
+
+	if (!removed) {
+		return;
+	}
+	for (IrBlock *b = f->blocks; b; b = b->next) {
+		for (IrInst *inst = b->first; inst; inst = inst->next) {
+			for (int i = 0; i < inst->nargs; i++) {
+				inst->args[i] = resolve(inst->args[i]);
+			}
+		}
+	}
+}
+
+// 副作用があり，値が使われなくても消せない命令
+static bool has_side_effect(IrInst *inst) {
+	switch (inst->op) {
+	case IR_STOREVAR:
+	case IR_CALL:
+	case IR_JMP:
+	case IR_BR:
+	case IR_RET:
+		return true;
+	default:
+		return false;
+	}
+}
+
+// 値が使われない命令を消す
+void dce(IrFunc *f) {
+	int cap = 256, len = 0;
+	IrInst **work = malloc(sizeof(IrInst *) * cap);
+	if (!work) {
+		error("メモリが足りません");
+	}
+
+	for (IrBlock *b = f->blocks; b; b = b->next) {
+		for (IrInst *inst = b->first; inst; inst = inst->next) {
+			inst->mark = has_side_effect(inst);
+			if (inst->mark) {
+				if (len == cap) {
+					cap *= 2;
+					work = realloc(work, sizeof(IrInst *) * cap);
+					if (!work) {
+						error("メモリが足りません");
+					}
+				}
+				work[len++] = inst;
+			}
+		}
+	}
+
+	// 使われている命令の引数をたどる
+	while (len) {
+		IrInst *inst = work[--len];
+		for (int i = 0; i < inst->nargs; i++) {
+			IrInst *arg = inst->args[i];
+			if (arg->mark || !arg->block) {
+				continue;
+			}
+			arg->mark = 1;
+			if (len == cap) {
+				cap *= 2;
+				work = realloc(work, sizeof(IrInst *) * cap);
+				if (!work) {
+					error("メモリが足りません");
+				}
+			}
+			work[len++] = arg;
+		}
+	}
+	free(work);
+
+	int removed = 0;
+	for (IrBlock *b = f->blocks; b; b = b->next) {
+		IrInst *next;
+		for (IrInst *inst = b->first; inst; inst = next) {
+			next = inst->next;
+			if (!inst->mark) {
+				ir_remove(inst);
+				removed++;
+			}
+		}
+	}
+	ctx->dce_removed += removed;
+}
+
+// -- 出力 --
+
+static char *ir_op_names[] = {
+	[IR_UNDEF] = "undef", [IR_PARAM] = "param", [IR_COPY] = "copy", [IR_PHI] = "phi",
+	[IR_ADD] = "add", [IR_SUB] = "sub", [IR_MUL] = "mul", [IR_DIV] = "div",
+	[IR_EQ] = "eq", [IR_NE] = "ne", [IR_LT] = "lt", [IR_LE] = "le",
+	[IR_ADDR] = "addr", [IR_LOAD] = "load", [IR_LOADVAR] = "loadvar",
+	[IR_STOREVAR] = "storevar", [IR_CALL] = "call", [IR_JMP] = "jmp",
+	[IR_BR] = "br", [IR_RET] = "ret",
+};
+
+static void dump_var(IrFunc *f, int var) {
+	LVar *lvar = f->vars[var];
+	if (lvar) {
+		emit_strn(lvar->name, lvar->len);
+	}
+	else {
+		emit("last");
+	}
+}
+
+static void dump_value(IrFunc *f, IrInst *inst) {
+	if (inst->op == IR_IMM) {
+		emit_int(inst->val);
+		return;
+	}
+	if (inst->var) {
+		dump_var(f, inst->var);
+		emit_char('.');
+	}
+	else {
+		emit_char('%');
+	}
+	emit_int(inst->id);
+}
+
+static void dump_block_name(IrBlock *block) {
+	emit("bb");
+	emit_int(block->id);
+}
+
+static void dump_inst(IrFunc *f, IrInst *inst) {
+	Token *tok;
+
+	emit("    ");
+	if (inst->op < IR_JMP && inst->op != IR_STOREVAR) {
+		dump_value(f, inst);
+		emit(" = ");
+	}
+	emit("%s", ir_op_names[inst->op]);
+
+	switch (inst->op) {
+	case IR_PARAM:
+		emit_char(' ');
+		emit_int(inst->val);
+		break;
+	case IR_ADDR:
+	case IR_LOADVAR:
+	case IR_STOREVAR:
+		emit_char(' ');
+		dump_var(f, inst->val);
+		if (inst->op == IR_STOREVAR) {
+			emit(", ");
+			dump_value(f, inst->args[0]);
+		}
+		break;
+	case IR_CALL:
+		tok = &ctx->tokens[inst->val];
+		emit_char(' ');
+		emit_strn(tok->str, tok->len);
+		emit_char('(');
+		for (int i = 0; i < inst->nargs; i++) {
+			if (i) {
+				emit(", ");
+			}
+			dump_value(f, inst->args[i]);
+		}
+		emit_char(')');
+		break;
+	case IR_PHI:
+		for (int i = 0; i < inst->nargs; i++) {
+			emit(i ? ", [" : " [");
+			dump_value(f, inst->args[i]);
+			emit(", ");
+			dump_block_name(inst->block->preds[i]);
+			emit_char(']');
+		}
+		break;
+	case IR_JMP:
+		emit_char(' ');
+		dump_block_name(inst->block->succ[0]);
+		break;
+	case IR_BR:
+		emit_char(' ');
+		dump_value(f, inst->args[0]);
+		emit(", ");
+		dump_block_name(inst->block->succ[0]);
+		emit(", ");
+		dump_block_name(inst->block->succ[1]);
+		break;
+	default:
+		for (int i = 0; i < inst->nargs; i++) {
+			emit(i ? ", " : " ");
+			dump_value(f, inst->args[i]);
+		}
+	}
+	emit_char('\n');
+}
+
+// 中間表現を出力する
+void dump_ir(IrFunc *f) {
+	Token *name = FUNC_NAME(f->node);
+	emit_strn(name->str, name->len);
+	emit(":\n");
+
+	for (IrBlock *b = f->blocks; b; b = b->next) {
+		dump_block_name(b);
+		emit_char(':');
+		if (b->npreds) {
+			emit(" ; preds");
+			for (int i = 0; i < b->npreds; i++) {
+				emit_char(' ');
+				dump_block_name(b->preds[i]);
+			}
+		}
+		emit_char('\n');
+		for (IrInst *inst = b->first; inst; inst = inst->next) {
+			dump_inst(f, inst);
+		}
+	}
+}
@@ -0,0 +1,98 @@
+// jit.c
+// 生成した機械語をその場で実行する(--run)
+
+// MAP_ANONYMOUSを使う
+#define _DEFAULT_SOURCE
+
+#include "9cc.h"
+
+#include <sys/mman.h>
+
+// 定義のない関数を結びつけるlibcの関数
+static struct {
+	char *name;
+	void *addr;
+} libc_funcs[] = {
+	{"putchar", (void *)putchar},
+	{"puts", (void *)puts},
+	{"printf", (void *)printf},
+	{"malloc", (void *)malloc},
+	{"calloc", (void *)calloc},
+	{"free", (void *)free},
+	{"exit", (void *)exit},
+	{"abort", (void *)abort},
+};
+
+// libcの関数へ飛ぶスタブ(jmp [rip+0]と飛び先のアドレス)
+// 生成したコードからは32ビットの変位で届かないので，スタブを経由して呼び出す
+#define STUB_SIZE 16
+
+static void *find_libc_func(Token *name) {
+	for (int i = 0; i < sizeof(libc_funcs) / sizeof(*libc_funcs); i++) {
+		if (strlen(libc_funcs[i].name) == name->len && !memcmp(libc_funcs[i].name, name->str, name->len)) {
+			return libc_funcs[i].addr;
+		}
+	}
+	error("未定義の関数です: %.*s", name->len, name->str);
+	return NULL;
+}
+
+// mainを呼び出してその値を返す
+static int run_main() {
+	Token main_name = {.str = "main", .len = 4};
+	Func *main_func = find_func(&main_name);
+	if (!main_func) {
+		error("main関数がありません");
+	}
+
+	// 機械語の後ろに呼び出しごとのスタブを置く
+	int stubs = (ctx->text_len + 15) / 16 * 16;
+	size_t size = stubs + (size_t)ctx->obj_calls_len * STUB_SIZE;
+	unsigned char *mem = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (mem == MAP_FAILED) {
+		error("実行用のメモリを確保できません");
+	}
+
+	int nstubs = 0;
+	for (int i = 0; i < ctx->obj_calls_len; i++) {
+		ObjCall *call = &ctx->obj_calls[i];
+		if (patch_call(call)) {
+			continue;
+		}
+		unsigned char *stub = mem + stubs + nstubs++ * STUB_SIZE;
+		void *addr = find_libc_func(&ctx->tokens[call->name]);
+		stub[0] = 0xff;
+		stub[1] = 0x25;
+		memset(stub + 2, 0, 4);
+		memcpy(stub + 6, &addr, 8);
+		int32_t rel = stub - mem - (call->offset + 4);
+		memcpy(ctx->text + call->offset, &rel, 4);
+	}
+	memcpy(mem, ctx->text, ctx->text_len);
+
+	if (mprotect(mem, size, PROT_READ | PROT_EXEC)) {
+		error("実行用のメモリを実行可能にできません");
+	}
+
+	// 関数ポインタとオブジェクトポインタの変換はC11では未定義だが，POSIXでは使える
+	long (*entry)() = (long (*)())(mem + main_func->text_offset);
+	int ret = (int)entry();
+	munmap(mem, size);
+	return ret;
+}
+
+int jit_run(Context *c, int *result) {
+	Context *save_ctx = ctx;
+	jmp_buf *save_jmp = error_jmp;
+
+	jmp_buf jmp;
+	ctx = c;
+	error_jmp = &jmp;
+	if (!setjmp(jmp)) {
+		*result = run_main();
+	}
+
+	ctx = save_ctx;
+	error_jmp = save_jmp;
+	return c->failed;
+}
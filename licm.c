@@ -0,0 +1,266 @@
+// licm.c
+// ループ不変式の移動
+
+#include "9cc.h"
+
+// 深さ優先探索でのブロックの状態(添字はブロックの番号 - block_base)
+enum {
+	DFS_NONE,
+	DFS_ACTIVE,	// 探索中(スタックに積まれている)
+	DFS_DONE,
+};
+
+static _Thread_local unsigned char *dfs_state;
+static _Thread_local int block_base;
+
+// 後ろ向きの辺(ループの末尾からループの先頭への辺)
+typedef struct {
+	IrBlock *latch, *header;
+} BackEdge;
+
+static _Thread_local BackEdge *back_edges;
+static _Thread_local int back_edges_len, back_edges_cap;
+
+// 探索とループの本体を求めるのに使うスタック
+static _Thread_local IrBlock **stack;
+static _Thread_local int *stack_succ;
+static _Thread_local int stack_len, stack_cap;
+
+static void push_block(IrBlock *block) {
+	if (stack_len == stack_cap) {
+		stack_cap = stack_cap ? stack_cap * 2 : 64;
+		stack = realloc(stack, sizeof(IrBlock *) * stack_cap);
+		stack_succ = realloc(stack_succ, sizeof(int) * stack_cap);
+		if (!stack || !stack_succ) {
+			error("メモリが足りません");
+		}
+	}
+	stack[stack_len] = block;
+	stack_succ[stack_len++] = 0;
+}
+
+static void add_back_edge(IrBlock *latch, IrBlock *header) {
+	if (back_edges_len == back_edges_cap) {
+		back_edges_cap = back_edges_cap ? back_edges_cap * 2 : 16;
+		back_edges = realloc(back_edges, sizeof(BackEdge) * back_edges_cap);
+		if (!back_edges) {
+			error("メモリが足りません");
+		}
+	}
+	back_edges[back_edges_len++] = (BackEdge){latch, header};
+}
+
+// 深さ優先で辿り，探索中のブロックへ戻る辺を集める
+// 構造化された制御フローなので，これがループの末尾から先頭への辺になる
+static void find_back_edges(IrFunc *fn) {
+	int max_id = 0;
+	for (IrBlock *b = fn->blocks; b; b = b->next) {
+		if (b->id > max_id) {
+			max_id = b->id;
+		}
+	}
+	block_base = fn->blocks->id;
+	dfs_state = calloc(max_id - block_base + 1, 1);
+	if (!dfs_state) {
+		error("メモリが足りません");
+	}
+
+	back_edges_len = 0;
+	stack_len = 0;
+	dfs_state[0] = DFS_ACTIVE;
+	push_block(fn->blocks);
+	while (stack_len) {
+		IrBlock *b = stack[stack_len - 1];
+		if (stack_succ[stack_len - 1] == 2) {
+			dfs_state[b->id - block_base] = DFS_DONE;
+			stack_len--;
+			continue;
+		}
+		IrBlock *s = b->succ[stack_succ[stack_len - 1]++];
+		if (!s) {
+			continue;
+		}
+		switch (dfs_state[s->id - block_base]) {
+		case DFS_NONE:
+			dfs_state[s->id - block_base] = DFS_ACTIVE;
+			push_block(s);
+			break;
+		case DFS_ACTIVE:
+			add_back_edge(b, s);
+			break;
+		}
+	}
+	free(dfs_state);
+}
+
+// ループの本体のブロックに印(mark = stamp)をつけ，ブロックの個数を返す
+// 末尾から前任ブロックを逆に辿り，先頭で止める
+static int mark_loop(IrBlock *header, int stamp) {
+	int n = 1;
+	header->mark = stamp;
+	stack_len = 0;
+	for (int i = 0; i < back_edges_len; i++) {
+		IrBlock *latch = back_edges[i].latch;
+		if (back_edges[i].header == header && latch->mark != stamp) {
+			latch->mark = stamp;
+			push_block(latch);
+			n++;
+		}
+	}
+	while (stack_len) {
+		IrBlock *b = stack[--stack_len];
+		for (int i = 0; i < b->npreds; i++) {
+			if (b->preds[i]->mark != stamp) {
+				b->preds[i]->mark = stamp;
+				push_block(b->preds[i]);
+				n++;
+			}
+		}
+	}
+	return n;
+}
+
+// ループの外から入る唯一の前任ブロックで，ループの先頭にしか進まないもの
+static IrBlock *find_preheader(IrBlock *header, int stamp) {
+	IrBlock *pre = NULL;
+	for (int i = 0; i < header->npreds; i++) {
+		IrBlock *p = header->preds[i];
+		if (p->mark == stamp) {
+			continue;
+		}
+		if (pre) {
+			return NULL;
+		}
+		pre = p;
+	}
+	if (!pre || pre->succ[1]) {
+		return NULL;
+	}
+	return pre;
+}
+
+// 副作用がなく，ループの前で先に計算してよい命令か
+// 読み込みはループ内の書き込みで値が変わりうるので移さない
+// 割り算は0や-1で割ると例外になるので，それ以外の定数で割るときだけ移す
+static bool can_hoist(IrInst *inst) {
+	switch (inst->op) {
+	case IR_ADD:
+	case IR_SUB:
+	case IR_MUL:
+	case IR_EQ:
+	case IR_NE:
+	case IR_LT:
+	case IR_LE:
+		return true;
+	case IR_DIV:
+		return inst->args[1]->op == IR_IMM && inst->args[1]->val != 0 && inst->args[1]->val != -1;
+	default:
+		return false;
+	}
+}
+
+// 引数がすべてループの外で決まる命令か
+static bool is_invariant(IrInst *inst, int stamp) {
+	for (int i = 0; i < inst->nargs; i++) {
+		IrInst *arg = inst->args[i];
+		if (arg->op != IR_IMM && arg->block->mark == stamp) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// 命令をブロックの末尾の命令の前に移す
+static void move_before_last(IrInst *inst, IrBlock *block) {
+	ir_remove(inst);
+	IrInst *last = block->last;
+	inst->block = block;
+	inst->prev = last->prev;
+	inst->next = last;
+	if (last->prev) {
+		last->prev->next = inst;
+	}
+	else {
+		block->first = inst;
+	}
+	last->prev = inst;
+}
+
+static void hoist_loop(IrFunc *fn, IrBlock *header, int stamp) {
+	mark_loop(header, stamp);
+	IrBlock *pre = find_preheader(header, stamp);
+	if (!pre) {
+		return;
+	}
+
+	// 移した命令を引数に持つ命令も不変になるので，変わらなくなるまで繰り返す
+	bool changed = true;
+	while (changed) {
+		changed = false;
+		for (IrBlock *b = fn->blocks; b; b = b->next) {
+			if (b->mark != stamp) {
+				continue;
+			}
+			IrInst *next;
+			for (IrInst *inst = b->first; inst; inst = next) {
+				next = inst->next;
+				if (can_hoist(inst) && is_invariant(inst, stamp)) {
+					move_before_last(inst, pre);
+					ctx->licm_hoisted++;
+					changed = true;
+				}
+			}
+		}
+	}
+}
+
+// ループの先頭とブロックの個数
+typedef struct {
+	IrBlock *header;
+	int size;
+} Loop;
+
+static int cmp_loop(const void *a, const void *b) {
+	return ((Loop *)a)->size - ((Loop *)b)->size;
+}
+
+// ループの中で値の変わらない式をループの前に移す
+// 変数はSSA形式なので，ループの中で代入される変数はループの先頭のphiか
+// ループの中の命令の値になり，アドレスを取られた変数は読み込みになる．
+// 引数がループの外の値と定数だけの式を不変とみなす
+void licm(IrFunc *fn) {
+	find_back_edges(fn);
+	if (!back_edges_len) {
+		return;
+	}
+
+	for (IrBlock *b = fn->blocks; b; b = b->next) {
+		b->mark = 0;
+	}
+
+	// 先頭ごとに1つのループにまとめる
+	Loop *loops = malloc(sizeof(Loop) * back_edges_len);
+	if (!loops) {
+		error("メモリが足りません");
+	}
+	int nloops = 0, stamp = 0;
+	for (int i = 0; i < back_edges_len; i++) {
+		IrBlock *header = back_edges[i].header;
+		bool seen = false;
+		for (int j = 0; j < i; j++) {
+			seen |= back_edges[j].header == header;
+		}
+		if (seen) {
+			continue;
+		}
+		loops[nloops].header = header;
+		loops[nloops++].size = mark_loop(header, ++stamp);
+	}
+
+	// 内側の(小さい)ループから移すと，移した命令を外側のループからさらに移せる
+	qsort(loops, nloops, sizeof(Loop), cmp_loop);
+	for (int i = 0; i < nloops; i++) {
+		hoist_loop(fn, loops[i].header, ++stamp);
+	}
+	free(loops);
+}
@@ -3,22 +3,162 @@
 
 #include "9cc.h"
 
+#include <fcntl.h>
+#include <unistd.h>
+
 int main(int argc, char **argv) {
-    if (argc != 2) {
-        fprintf(stderr, "引数の個数が正しくありません");
-        return 1;
-    }
-
-	// 入力を覚えておく
-	user_input = argv[1];
-
-	// トークナイズしてパースする
-	// 結果(AST)はcodeに保存される
-	tokenize(user_input);
-	program();
-
-	// コード生成
-	codegen();
-	
+	bool opt_stats = false;
+	bool opt_run = false;
+	bool opt_batch = false;
+	char *input = NULL;
+	char *output = NULL;
+	char *trace = NULL;
+
+	Context *c = new_context();
+	if (!c) {
+		fprintf(stderr, "メモリが足りません\n");
+		return 1;
+	}
+
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "--stats")) {
+			opt_stats = true;
+			continue;
+		}
+		if (!strcmp(argv[i], "--no-peephole")) {
+			c->opt_peephole = false;
+			continue;
+		}
+		if (!strcmp(argv[i], "--no-sccp")) {
+			c->opt_sccp = false;
+			continue;
+		}
+		if (!strcmp(argv[i], "--no-licm")) {
+			c->opt_licm = false;
+			continue;
+		}
+		if (!strcmp(argv[i], "--no-tailcall")) {
+			c->opt_tailcall = false;
+			continue;
+		}
+		if (!strncmp(argv[i], "--inline-threshold=", 19)) {
+			c->inline_threshold = atoi(argv[i] + 19);
+			continue;
+		}
+		if (!strncmp(argv[i], "--threads=", 10)) {
+			c->codegen_threads = atoi(argv[i] + 10);
+			continue;
+		}
+		if (!strncmp(argv[i], "--trace=", 8)) {
+			trace = argv[i] + 8;
+			c->opt_trace = true;
+			continue;
+		}
+		if (!strncmp(argv[i], "--cache=", 8)) {
+			c->cache_dir = argv[i] + 8;
+			continue;
+		}
+		if (!strcmp(argv[i], "--inline-report")) {
+			c->opt_inline_report = true;
+			continue;
+		}
+		if (!strcmp(argv[i], "--run")) {
+			opt_run = true;
+			c->opt_object = true;
+			continue;
+		}
+		if (!strcmp(argv[i], "-c")) {
+			c->opt_object = true;
+			continue;
+		}
+		if (!strcmp(argv[i], "--batch")) {
+			opt_batch = true;
+			continue;
+		}
+		if (!strcmp(argv[i], "--dump-ir")) {
+			c->opt_dump_ir = true;
+			continue;
+		}
+		if (!strcmp(argv[i], "-o")) {
+			if (++i == argc) {
+				fprintf(stderr, "-oの後に出力ファイル名がありません\n");
+				return 1;
+			}
+			output = argv[i];
+			continue;
+		}
+		if (opt_batch) {
+			// 残りの引数はすべて入力ファイル
+			if (output || opt_run || trace) {
+				fprintf(stderr, "--batchでは-o, --run, --traceを使えません\n");
+				return 1;
+			}
+			int failed = compile_batch(c, argv + i, argc - i, c->codegen_threads);
+			free_context(c);
+			return failed ? 1 : 0;
+		}
+		if (input) {
+			input = NULL;
+			break;
+		}
+		input = argv[i];
+	}
+
+	if (!input) {
+		fprintf(stderr, "引数の個数が正しくありません");
+		return 1;
+	}
+
+	// 入力のトークンはinの中を指すので，コンパイルした関数を実行し終えるまで閉じない
+	Input in;
+	if (!open_input(input, &in)) {
+		fprintf(stderr, "%sを読めません\n", input);
+		return 1;
+	}
+	c->input_name = in.name;
+
+	// 出力先
+	int fd = 1;
+	if (output && strcmp(output, "-")) {
+		fd = open(output, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+		if (fd < 0) {
+			fprintf(stderr, "%sを開けません\n", output);
+			return 1;
+		}
+	}
+
+	// --runなら何も出力せず，コンパイルした関数をこのプロセスで実行する
+	bool run = opt_run && !c->opt_dump_ir;
+	OutBuf out = {0};
+	if (compile(c, in.data, in.len, run ? NULL : &out)) {
+		fprintf(stderr, "%s\n", c->error_msg ? c->error_msg : "メモリが足りません");
+		return 1;
+	}
+	if (!write_all(fd, out.data, out.len)) {
+		fprintf(stderr, "出力に失敗しました\n");
+		return 1;
+	}
+	free(out.data);
+
+	if (opt_stats) {
+		print_stats(c);
+	}
+	if (trace && !write_trace(c, trace)) {
+		fprintf(stderr, "%sに書き出せません\n", trace);
+		return 1;
+	}
+
+	// mainの値で終了する
+	if (run) {
+		int ret;
+		if (jit_run(c, &ret)) {
+			fprintf(stderr, "%s\n", c->error_msg ? c->error_msg : "メモリが足りません");
+			return 1;
+		}
+		return ret;
+	}
+	free_context(c);
+	close_input(&in);
+
 	return 0;
 }
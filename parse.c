@@ -3,40 +3,118 @@
 
 #include "9cc.h"
 
+// 新しいノードのための領域をプールに確保する
+// sizeはペイロードのワード数，countは子の個数
+static NodeId alloc_node(NodeKind kind, int count, int size) {
+	if (!ctx->node_pool_len) {
+		ctx->node_pool_len = 1;	// 添字0は「ノードなし」
+	}
+	if (ctx->node_pool_len + 1 + size > ctx->node_pool_cap) {
+		while (ctx->node_pool_len + 1 + size > ctx->node_pool_cap) {
+			ctx->node_pool_cap = ctx->node_pool_cap ? ctx->node_pool_cap * 2 : 4096;
+		}
+		ctx->node_pool = realloc(ctx->node_pool, sizeof(uint32_t) * ctx->node_pool_cap);
+		if (!ctx->node_pool) {
+			error("メモリが足りません");
+		}
+	}
+
+	NodeId node = ctx->node_pool_len;
+	ctx->node_pool_len += 1 + size;
+	ctx->node_pool[node] = kind | (uint32_t)count << 8;
+	ctx->node_count_total++;
+	ctx->node_kinds[kind]++;
+	return node;
+}
+
 // 新しいノードを作成する
-Node *new_node(NodeKind kind, Node *lhs, Node *rhs) {
-	Node *node = calloc(1, sizeof(Node));
-	node->kind = kind;
-	node->lhs = lhs;
-	node->rhs = rhs;
+NodeId new_node(NodeKind kind, NodeId lhs, NodeId rhs) {
+	NodeId node = alloc_node(kind, 0, 2);
+	LHS(node) = lhs;
+	RHS(node) = rhs;
+	return node;
+}
+
+// 新しい単項演算のノードを作成する
+NodeId new_node_unary(NodeKind kind, NodeId lhs) {
+	NodeId node = alloc_node(kind, 0, 1);
+	LHS(node) = lhs;
 	return node;
 }
 
 // 新しい整数ノードを作成する
-Node *new_node_num(int val) {
-	Node *node = calloc(1, sizeof(Node));
-	node->kind = ND_NUM;
-	node->val = val;
+NodeId new_node_num(int val) {
+	NodeId node = alloc_node(ND_NUM, 0, 1);
+	NUM_VAL(node) = val;
 	return node;
 }
 
-// defを保存する
-Node *code[100];
+// 新しいローカル変数のノードを作成する
+NodeId new_node_lvar(int offset) {
+	NodeId node = alloc_node(ND_LVAR, 0, 1);
+	LVAR_OFFSET(node) = offset;
+	return node;
+}
+
+// 新しいブロックのノードを作成する
+NodeId new_node_block(NodeId *stmts, int count) {
+	NodeId node = alloc_node(ND_BLOCK, count, count);
+	memcpy(&BLOCK_STMT(node, 0), stmts, sizeof(NodeId) * count);
+	return node;
+}
+
+// 子ノードはctx->child_stackに一時的に積んでおき，
+// 個数が確定してからND_BLOCKなどのノードにまとめて移す
+static void push_child(NodeId node) {
+	if (ctx->child_stack_len == ctx->child_stack_cap) {
+		ctx->child_stack_cap = ctx->child_stack_cap ? ctx->child_stack_cap * 2 : 256;
+		ctx->child_stack = realloc(ctx->child_stack, sizeof(NodeId) * ctx->child_stack_cap);
+		if (!ctx->child_stack) {
+			error("メモリが足りません");
+		}
+	}
+	ctx->child_stack[ctx->child_stack_len++] = node;
+}
+
+// child_stack[base..]の子を持つ長さ可変のノードを作成する
+// headは子の前に置くワードの個数で，呼び出し側が埋める
+static NodeId new_node_list(NodeKind kind, int base, int head) {
+	int count = ctx->child_stack_len - base;
+	NodeId node = alloc_node(kind, count, head + count);
+	memcpy(&ctx->node_pool[node + 1 + head], &ctx->child_stack[base], sizeof(NodeId) * count);
+	ctx->child_stack_len = base;
+	return node;
+}
+
+static void register_func(Func *func);
+static void check_call(uint32_t name, int nargs);
+static void check_pending_calls();
 
 // program = def*
 void program() {
-	int i = 0;
-
-	while (!at_eof()) {
-		code[i++] = def();
+	for (;;) {
+		if (ctx->code_len == ctx->code_cap) {
+			ctx->code_cap = ctx->code_cap ? ctx->code_cap * 2 : 64;
+			ctx->code = realloc(ctx->code, sizeof(NodeId) * ctx->code_cap);
+			if (!ctx->code) {
+				error("メモリが足りません");
+			}
+		}
+		if (at_eof()) {
+			break;
+		}
+		ctx->code[ctx->code_len++] = def();
 	}
-	code[i] == NULL;	// 末尾を示す
+	ctx->code[ctx->code_len] = 0;	// 末尾を示す
+
+	check_pending_calls();
 }
 
-Func *functions = NULL;
+// 引数を渡すレジスタの個数
+#define MAX_ARGS 6
 
 // def = "int" ident '(' expr* ')' '{' stmt* '}'
-Node *def() {
+NodeId def() {
 	if (!consume_token(TK_INTTYPE)) {
 		error("型名がありません");
 	}
@@ -47,26 +125,20 @@ Node *def() {
 	if (!tok) {
 		error("識別子ではありません");
 	}
+	uint32_t name = tok - ctx->tokens;
 
 	expect("(");
 
-	Node *node = calloc(1, sizeof(Node));	
-	node->kind = ND_FUNC;
-	node->name = tok->str;
-	node->len = tok->len;
-
-	Func *func = calloc(1, sizeof(Func));
-	func->node = node;
-	func->next = functions;
+	Func *func = arena_alloc(&ctx->arena, sizeof(Func));
+	func->next = ctx->functions;
 	func->locals = NULL;
+	func->name = name;
 
-	functions = func;
-	
-	Node head;
-	head.next = NULL;
-	Node *arg = &head;
+	ctx->functions = func;
 
-	// 引数
+	// 引数は関数の本体と同じスコープに置く
+	enter_scope();
+	int base = ctx->child_stack_len;
 	while (!consume(")") && !at_eof()) {
 	
 		if (!consume_token(TK_INTTYPE)) {
@@ -77,37 +149,37 @@ Node *def() {
 		if (!tok) {
 			error("識別子ではありません");
 		}
+		if (ctx->child_stack_len - base == MAX_ARGS) {
+			error_at(tok->str, "引数が多すぎます");
+		}
 
 		LVar *lvar = new_lvar(tok);
-		arg->next = calloc(1, sizeof(Node));
-		arg = arg->next;
-
-		arg->kind = ND_ARG;
-		arg->offset = lvar->offset;
+		push_child(lvar->offset);
 		
 		if (!consume(",")) {
 			expect(")");
 			break;
 		}
 	}
-	arg->next = NULL;
 
-	node->args = head.next;
-
-	Node *block_head = calloc(1, sizeof(Node));
-	block_head->kind = ND_BLOCK;
-	Node *cur = block_head;
+	func->nparams = ctx->child_stack_len - base;
+	register_func(func);
 
 	// "{" stmt* "}"
 	expect("{");
+	int body_base = ctx->child_stack_len;
 	while ((!consume("}")) && (!at_eof())) {
-		cur->next = stmt();
-		cur = cur->next;
+		push_child(stmt());
 	}
-	cur->next = NULL;
+	NodeId body = new_node_list(ND_BLOCK, body_base, 0);
+	leave_scope();
 
-	node->body = block_head;
-	
+	NodeId node = new_node_list(ND_FUNC, base, 2);
+	ctx->node_pool[node + 1] = name;
+	FUNC_BODY(node) = body;
+
+	func->node = node;
+	func->tok_end = ctx->token_pos;
 	return node;
 }
 
@@ -118,100 +190,84 @@ Node *def() {
 //		| "for (" expr? ";" expr? ";" expr? ")" stmt
 //		| "{" stmt* "}"
 //		| "int" ident ';'
-Node *stmt() {
-	Node *node;
+NodeId stmt() {
+	NodeId node;
 
 	if (consume_token(TK_RETURN)) {	// return文
-		node = calloc(1, sizeof(Node));
-		node->kind = ND_RETURN;
-		node->lhs = expr();
+		node = new_node_unary(ND_RETURN, expr());
 	}
 	else if (consume_token(TK_IF)) {	// if文
 		expect("(");
-		node = calloc(1, sizeof(Node));
-		node->kind = ND_IF;
-		node->cond = expr();
+		NodeId cond = expr();
 		expect(")");
-		node->lhs = stmt();
+		NodeId then = stmt();
+		NodeId els = 0;
 
 		if (consume_token(TK_ELSE)) {
-			node->rhs = stmt();
-		}
-		else {
-			node->rhs = NULL;
+			els = stmt();
 		}
+
+		node = alloc_node(ND_IF, 0, 3);
+		IF_COND(node) = cond;
+		IF_THEN(node) = then;
+		IF_ELSE(node) = els;
 		return node;
 	}
 	else if (consume_token(TK_WHILE)) {
 		expect("(");
-		node = calloc(1, sizeof(Node));
-		node->kind = ND_WHILE;
-		node->cond = expr();
+		NodeId cond = expr();
 		expect(")");
-		node->lhs = stmt();
+		NodeId body = stmt();
 
+		node = alloc_node(ND_WHILE, 0, 2);
+		WHILE_COND(node) = cond;
+		WHILE_BODY(node) = body;
 		return node;
 	}
 	else if (consume_token(TK_FOR)) {
 		expect("(");
-		node = calloc(1, sizeof(Node));
-		node->kind = ND_FOR;
-		if (consume(";")) {
-			node->lhs = NULL;
-		}
-		else {
-			node->lhs = expr();
+		NodeId init = 0, cond = 0, inc = 0;
+		if (!consume(";")) {
+			init = expr();
 			expect(";");
 		}
 
-		if (consume(";")) {
-			node->cond = NULL;
-		}
-		else {
-			node->cond = expr();
+		if (!consume(";")) {
+			cond = expr();
 			expect(";");
 		}
 
 		if (!consume(")")) {
-			node->inc = expr();
+			inc = expr();
 			expect(")");
 		}
-		else {
-			node->inc = NULL;
-		}
-		
-		node->rhs = stmt();
 		
+		NodeId body = stmt();
+
+		node = alloc_node(ND_FOR, 0, 4);
+		FOR_INIT(node) = init;
+		FOR_COND(node) = cond;
+		FOR_INC(node) = inc;
+		FOR_BODY(node) = body;
 		return node;
 	}
 	else if (consume("{")) {
-		Node *head = calloc(1, sizeof(Node));
-		head->kind = ND_BLOCK;
-		Node *cur = head;
+		int base = ctx->child_stack_len;
+		enter_scope();
 		while (!consume("}") && !at_eof()) {
-			cur->next = stmt();
-			cur = cur->next;
+			push_child(stmt());
 		}
-		cur->next = NULL;
-		return head;
+		leave_scope();
+		return new_node_list(ND_BLOCK, base, 0);
 	}
 	else if (consume_token(TK_INTTYPE)) {
 		Token *tok = consume_token(TK_IDENT);
 		if (!tok) {
 			error("識別子ではありません");
 		}
-		LVar *lvar = find_lvar(tok);
-		if (lvar) {
-			error("すでに定義された変数です");
-		}
-		lvar = new_lvar(tok);
+		LVar *lvar = new_lvar(tok);
 		
-		node = calloc(1, sizeof(Node));
-		node->kind = ND_LVAR;
-		node->name = tok->str;
-		node->len = tok->len;
-
-		node->offset = lvar->offset;
+		node = new_node_lvar(lvar->offset);
 	}
 	else {
 		node = expr();
@@ -222,13 +278,13 @@ Node *stmt() {
 }
 
 // expr = assign
-Node *expr() {
+NodeId expr() {
 	return assign();
 }
 
 // assign = equality ("=" assign)?
-Node *assign() {
-	Node *node = equality();
+NodeId assign() {
+	NodeId node = equality();
 
 	if (consume("=")) {
 		node = new_node(ND_ASSIGN, node, assign());
@@ -237,8 +293,8 @@ Node *assign() {
 }
 
 // equality = relational ("==" relational | "!=" relational)*
-Node *equality() {
-	Node *node = relational();
+NodeId equality() {
+	NodeId node = relational();
 
 	for (;;) {
 		if (consume("==")) {
@@ -254,8 +310,8 @@ Node *equality() {
 }
 
 // relational = add ("<" add | "<=" add | ">" add | ">=" add)*
-Node *relational() {
-	Node *node = add();
+NodeId relational() {
+	NodeId node = add();
 
 	for (;;) {
 		if (consume("<")) {
@@ -277,8 +333,8 @@ Node *relational() {
 }
 
 // add = mul ('+' mul | '-' mul)*
-Node *add() {
-	Node *node = mul();
+NodeId add() {
+	NodeId node = mul();
 
 	for (;;) {
 		if (consume("+")) {
@@ -294,8 +350,8 @@ Node *add() {
 }
 
 // mul = unary ('*' unary | '/' unary)*
-Node *mul() {
-	Node *node = unary();
+NodeId mul() {
+	NodeId node = unary();
 
 	for (;;) {
 		if (consume("*")) {
@@ -311,7 +367,7 @@ Node *mul() {
 }
 
 // unary = ('+'|'-')? primary
-Node *unary() {
+NodeId unary() {
 	if (consume("+")) {
 		return primary();
 	}
@@ -319,10 +375,10 @@ Node *unary() {
 		return new_node(ND_SUB, new_node_num(0), primary());
 	}
 	if (consume("&")) {
-		return new_node(ND_ADDR, unary(), NULL);
+		return new_node_unary(ND_ADDR, unary());
 	}
 	if (consume("*")) {
-		return new_node(ND_DEREF, unary(), NULL);
+		return new_node_unary(ND_DEREF, unary());
 	}
 	return primary();
 }
@@ -330,10 +386,10 @@ Node *unary() {
 // primary = num 
 //		   | ident ("(" expr* ")")?
 //		   | '(' expr ')'
-Node *primary() {
+NodeId primary() {
 	// '(' expr ')'
 	if (consume("(")) {
-		Node *node = expr();
+		NodeId node = expr();
 		expect(")");
 		return node;
 	}
@@ -342,28 +398,24 @@ Node *primary() {
 	Token *tok = consume_token(TK_IDENT);
 
 	if (tok) {
-		Node *node = calloc(1, sizeof(Node));
 		if (consume("(")) {	// 関数呼び出し
-			node->kind = ND_FUNCALL;
-			node->name = tok->str;
-			node->len = tok->len; 
-
-			Node head;
-			head.next = NULL;
-			Node *arg = &head;
+			uint32_t name = tok - ctx->tokens;
+			int base = ctx->child_stack_len;
 			while (!consume(")") && !at_eof()) {
-				arg->next = expr();
-				arg = arg->next;
+				if (ctx->child_stack_len - base == MAX_ARGS) {
+					error_at(tok->str, "引数が多すぎます");
+				}
+				push_child(expr());
 				if (!consume(",")) {
 					expect(")");
 					break;
 				}
 			}
-			node->args = head.next;
-			
+			check_call(name, ctx->child_stack_len - base);
+			NodeId node = new_node_list(ND_FUNCALL, base, 1);
+			ctx->node_pool[node + 1] = name;
 			return node;
 		}
-		node->kind = ND_LVAR;
 
 		LVar *lvar = find_lvar(tok);
 
@@ -371,39 +423,199 @@ Node *primary() {
 			error("定義されていない変数です");
 		}
 		
-		node->offset = lvar->offset;
-
-		return node; 
+		return new_node_lvar(lvar->offset);
 	}
 
 	// num
 	return new_node_num(expect_number());
 }
 
+// 名前のハッシュ値(FNV-1a)
+static uint32_t hash_name(char *name, int len) {
+	uint32_t h = 2166136261u;
+	for (int i = 0; i < len; i++) {
+		h = (h ^ (unsigned char)name[i]) * 16777619u;
+	}
+	return h;
+}
+
+// ローカル変数の記号表
+// 同じバケットでは後から宣言した変数ほど前に並ぶので，
+// 先頭から探せば最も内側のスコープの変数が見つかる
+static void lvar_bucket_insert(LVar *var) {
+	LVar **bucket = &ctx->lvar_buckets[var->hash & (ctx->lvar_buckets_cap - 1)];
+	var->hash_next = *bucket;
+	*bucket = var;
+}
+
+// 記号表を2倍に広げる
+// スコープスタックを宣言順に挿入し直すと，バケット内の順序も保たれる
+static void lvar_table_grow() {
+	ctx->lvar_buckets_cap = ctx->lvar_buckets_cap ? ctx->lvar_buckets_cap * 2 : 64;
+	free(ctx->lvar_buckets);
+	ctx->lvar_buckets = calloc(ctx->lvar_buckets_cap, sizeof(LVar *));
+	if (!ctx->lvar_buckets) {
+		error("メモリが足りません");
+	}
+	for (int i = 0; i < ctx->scope_vars_len; i++) {
+		lvar_bucket_insert(ctx->scope_vars[i]);
+	}
+}
+
+// ブロックのスコープに入る
+void enter_scope() {
+	ctx->scope_depth++;
+}
+
+// ブロックのスコープを抜け，その中で宣言された変数を記号表から取り除く
+// 変数は宣言と逆順に取り除くので，常にバケットの先頭にある
+void leave_scope() {
+	while (ctx->scope_vars_len && ctx->scope_vars[ctx->scope_vars_len - 1]->depth == ctx->scope_depth) {
+		LVar *var = ctx->scope_vars[--ctx->scope_vars_len];
+		ctx->lvar_buckets[var->hash & (ctx->lvar_buckets_cap - 1)] = var->hash_next;
+	}
+	ctx->scope_depth--;
+}
+
 // 変数を名前で検索する．見つからなければNULLを返す
 LVar *find_lvar(Token *tok) {
-	for (LVar *var = functions->locals; var; var = var->next) {
-		if (var->len == tok->len && !memcmp(tok->str, var->name, var->len)) {
+	if (!ctx->lvar_buckets_cap) {
+		return NULL;
+	}
+	uint32_t h = hash_name(tok->str, tok->len);
+	for (LVar *var = ctx->lvar_buckets[h & (ctx->lvar_buckets_cap - 1)]; var; var = var->hash_next) {
+		if (var->hash == h && var->len == tok->len && !memcmp(tok->str, var->name, var->len)) {
 			return var;
 		}
 	}
 	return NULL;
 }
 
+// 現在のスコープに変数を宣言する
+// 同じスコープに同名の変数があればエラー
 LVar *new_lvar(Token *tok) {
-	LVar *lvar = calloc(1, sizeof(LVar));
+	LVar *dup = find_lvar(tok);
+	if (dup && dup->depth == ctx->scope_depth) {
+		error_at(tok->str, "すでに定義された変数です");
+	}
+
+	LVar *lvar = arena_alloc(&ctx->arena, sizeof(LVar));
+	ctx->lvar_count++;
 	
-	lvar->next = functions->locals;
+	lvar->next = ctx->functions->locals;
 	lvar->name = tok->str;
 	lvar->len = tok->len;
+	lvar->hash = hash_name(tok->str, tok->len);
+	lvar->depth = ctx->scope_depth;
 	
-	if (functions->locals) {
-		lvar->offset = functions->locals->offset + 8;
+	if (ctx->functions->locals) {
+		lvar->offset = ctx->functions->locals->offset + 8;
 	}
 	else {
 		lvar->offset = 8;
 	}
 
-	functions->locals = lvar;
+	ctx->functions->locals = lvar;
+
+	if (ctx->scope_vars_len == ctx->scope_vars_cap) {
+		ctx->scope_vars_cap = ctx->scope_vars_cap ? ctx->scope_vars_cap * 2 : 64;
+		ctx->scope_vars = realloc(ctx->scope_vars, sizeof(LVar *) * ctx->scope_vars_cap);
+		if (!ctx->scope_vars) {
+			error("メモリが足りません");
+		}
+	}
+	ctx->scope_vars[ctx->scope_vars_len++] = lvar;
+
+	if (ctx->scope_vars_len > ctx->lvar_buckets_cap / 2) {
+		lvar_table_grow();
+	}
+	else {
+		lvar_bucket_insert(lvar);
+	}
 	return lvar;
 }
+
+// 関数の表
+// 名前から関数定義を引く
+static void func_bucket_insert(Func *func) {
+	Func **bucket = &ctx->func_buckets[func->hash & (ctx->func_buckets_cap - 1)];
+	func->hash_next = *bucket;
+	*bucket = func;
+}
+
+// 関数を名前で検索する．見つからなければNULLを返す
+Func *find_func(Token *tok) {
+	if (!ctx->func_buckets_cap) {
+		return NULL;
+	}
+	uint32_t h = hash_name(tok->str, tok->len);
+	for (Func *func = ctx->func_buckets[h & (ctx->func_buckets_cap - 1)]; func; func = func->hash_next) {
+		Token *name = &ctx->tokens[func->name];
+		if (func->hash == h && name->len == tok->len && !memcmp(tok->str, name->str, name->len)) {
+			return func;
+		}
+	}
+	return NULL;
+}
+
+// 関数を表に登録する
+// 同名の関数がすでにあればエラー
+static void register_func(Func *func) {
+	Token *name = &ctx->tokens[func->name];
+	if (find_func(name)) {
+		error_at(name->str, "すでに定義された関数です");
+	}
+	func->hash = hash_name(name->str, name->len);
+
+	if (++ctx->func_count > ctx->func_buckets_cap / 2) {
+		int old_cap = ctx->func_buckets_cap;
+		Func **old = ctx->func_buckets;
+		ctx->func_buckets_cap = ctx->func_buckets_cap ? ctx->func_buckets_cap * 2 : 64;
+		ctx->func_buckets = calloc(ctx->func_buckets_cap, sizeof(Func *));
+		if (!ctx->func_buckets) {
+			error("メモリが足りません");
+		}
+		for (int i = 0; i < old_cap; i++) {
+			for (Func *f = old[i], *next; f; f = next) {
+				next = f->hash_next;
+				func_bucket_insert(f);
+			}
+		}
+		free(old);
+	}
+	func_bucket_insert(func);
+}
+
+// 呼び出し先を引いて引数の個数を検査する
+// 未定義の関数は後で定義されるか外部の関数とみなし，programの最後に検査する
+static void check_call(uint32_t name, int nargs) {
+	Func *func = find_func(&ctx->tokens[name]);
+	if (func) {
+		if (func->nparams != nargs) {
+			error_at(ctx->tokens[name].str, "引数の個数が違います(%d個必要です)", func->nparams);
+		}
+		return;
+	}
+
+	if (ctx->pending_calls_len == ctx->pending_calls_cap) {
+		ctx->pending_calls_cap = ctx->pending_calls_cap ? ctx->pending_calls_cap * 2 : 64;
+		ctx->pending_calls = realloc(ctx->pending_calls, sizeof(PendingCall) * ctx->pending_calls_cap);
+		if (!ctx->pending_calls) {
+			error("メモリが足りません");
+		}
+	}
+	ctx->pending_calls[ctx->pending_calls_len].name = name;
+	ctx->pending_calls[ctx->pending_calls_len].nargs = nargs;
+	ctx->pending_calls_len++;
+}
+
+static void check_pending_calls() {
+	for (int i = 0; i < ctx->pending_calls_len; i++) {
+		PendingCall *call = &ctx->pending_calls[i];
+		Func *func = find_func(&ctx->tokens[call->name]);
+		if (func && func->nparams != call->nargs) {
+			error_at(ctx->tokens[call->name].str, "引数の個数が違います(%d個必要です)", func->nparams);
+		}
+	}
+	ctx->pending_calls_len = 0;
+}
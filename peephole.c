@@ -0,0 +1,322 @@
+// peephole.c
+// 命令列に対する覗き穴最適化
+
+#include "9cc.h"
+
+static char *pattern_names[] = {
+	[PH_PUSH_POP] = "push-pop",
+	[PH_SELF_MOVE] = "self-move",
+	[PH_DEAD_MOVE] = "dead-move",
+	[PH_COPY] = "copy",
+	[PH_IMM_OPERAND] = "imm-operand",
+	[PH_MEM_OPERAND] = "mem-operand",
+	[PH_COMMUTE] = "commute",
+	[PH_ADDR_FOLD] = "addr-fold",
+};
+
+// パターンごとの適用回数を標準エラー出力に表示する
+void print_peephole_stats(Context *c) {
+	for (int i = 0; i < NUM_PATTERNS; i++) {
+		fprintf(stderr, "peephole %s: %ld\n", pattern_names[i], c->pattern_hits[i]);
+	}
+}
+
+// フラグを1つのレジスタとして扱う
+#define FLAGS_BIT (1u << NUM_X86_REGS)
+
+#define BIT(reg) (1u << (reg))
+
+// 関数呼び出しで壊れるレジスタ
+#define CALLER_SAVED (BIT(REG_RAX) | BIT(REG_RCX) | BIT(REG_RDX) | BIT(REG_RSI) | \
+		BIT(REG_RDI) | BIT(REG_R8) | BIT(REG_R9) | BIT(REG_R10) | BIT(REG_R11) | FLAGS_BIT)
+
+static Reg argreg[] = {REG_RDI, REG_RSI, REG_RDX, REG_RCX, REG_R8, REG_R9};
+
+// オペランドに書き込むときに使うレジスタ(メモリのベースと添字)
+static unsigned operand_addr_uses(Operand *opd) {
+	if (opd->kind != OPD_MEM) {
+		return 0;
+	}
+	return BIT(opd->reg) | (opd->scale ? BIT(opd->index) : 0);
+}
+
+// オペランドを読むときに使うレジスタ
+static unsigned operand_uses(Operand *opd) {
+	if (opd->kind == OPD_REG) {
+		return BIT(opd->reg);
+	}
+	return operand_addr_uses(opd);
+}
+
+// 命令が読むレジスタ
+static unsigned inst_reads(Inst *inst) {
+	unsigned r = 0;
+
+	switch (inst->op) {
+	case OP_MOV:
+	case OP_MOVZB:
+	case OP_LEA:
+		return operand_uses(&inst->src) | operand_addr_uses(&inst->dst);
+	case OP_PUSH:
+		return operand_uses(&inst->dst) | BIT(REG_RSP);
+	case OP_POP:
+		return BIT(REG_RSP);
+	case OP_IMUL:
+		if (inst->src.kind == OPD_NONE) {
+			return operand_uses(&inst->dst) | BIT(REG_RAX);
+		}
+		return operand_uses(&inst->dst) | operand_uses(&inst->src);
+	case OP_ADD:
+	case OP_SUB:
+	case OP_AND:
+	case OP_SHL:
+	case OP_SHR:
+	case OP_SAR:
+	case OP_CMP:
+		return operand_uses(&inst->dst) | operand_uses(&inst->src);
+	case OP_NEG:
+		return operand_uses(&inst->dst);
+	case OP_CQO:
+		return BIT(REG_RAX);
+	case OP_IDIV:
+		return operand_uses(&inst->dst) | BIT(REG_RAX) | BIT(REG_RDX);
+	case OP_SETCC:
+		// 下位8ビットだけ書き換えるので，残りを読むとみなす
+		return operand_uses(&inst->dst) | FLAGS_BIT;
+	case OP_JCC:
+		return FLAGS_BIT;
+	case OP_CALL:
+		for (int i = 0; i < inst->src.val; i++) {
+			r |= BIT(argreg[i]);
+		}
+		return r | BIT(REG_RSP);
+	case OP_JMP:
+		if (inst->dst.kind != OPD_SYM) {
+			return 0;
+		}
+		// 末尾呼び出しは引数と呼び出し先保存レジスタを読む
+		for (int i = 0; i < inst->src.val; i++) {
+			r |= BIT(argreg[i]);
+		}
+		return r | BIT(REG_RSP) | BIT(REG_RBX) | BIT(REG_RBP) |
+			BIT(REG_R12) | BIT(REG_R13) | BIT(REG_R14) | BIT(REG_R15);
+	case OP_RET:
+		return BIT(REG_RAX) | BIT(REG_RSP) | BIT(REG_RBX) | BIT(REG_RBP) |
+			BIT(REG_R12) | BIT(REG_R13) | BIT(REG_R14) | BIT(REG_R15);
+	}
+	return 0;
+}
+
+// 命令が書き込むレジスタ
+static unsigned inst_writes(Inst *inst) {
+	unsigned dst = inst->dst.kind == OPD_REG ? BIT(inst->dst.reg) : 0;
+
+	switch (inst->op) {
+	case OP_MOV:
+	case OP_MOVZB:
+	case OP_LEA:
+		return dst;
+	case OP_PUSH:
+		return BIT(REG_RSP);
+	case OP_POP:
+		return dst | BIT(REG_RSP);
+	case OP_IMUL:
+		if (inst->src.kind == OPD_NONE) {
+			return BIT(REG_RAX) | BIT(REG_RDX) | FLAGS_BIT;
+		}
+		return dst | FLAGS_BIT;
+	case OP_ADD:
+	case OP_SUB:
+	case OP_AND:
+	case OP_NEG:
+	case OP_SHL:
+	case OP_SHR:
+	case OP_SAR:
+		return dst | FLAGS_BIT;
+	case OP_CMP:
+		return FLAGS_BIT;
+	case OP_CQO:
+		return BIT(REG_RDX);
+	case OP_IDIV:
+		return BIT(REG_RAX) | BIT(REG_RDX) | FLAGS_BIT;
+	case OP_SETCC:
+		return dst;
+	case OP_CALL:
+		return CALLER_SAVED;
+	}
+	return 0;
+}
+
+// 分岐やラベルをまたいで生きているレジスタ
+// ブロックをまたぐ値はスタック上に置くので，レジスタに残るのはフレームだけ
+#define BRANCH_LIVE (BIT(REG_RSP) | BIT(REG_RBP))
+
+// insts[i]以降でregsの値が使われないなら真
+static bool is_dead(int i, unsigned regs) {
+	for (; i < insts_len; i++) {
+		Inst *inst = &insts[i];
+		if (inst_reads(inst) & regs) {
+			return false;
+		}
+		if (inst->op == OP_LABEL || inst->op == OP_JMP || inst->op == OP_JCC || inst->op == OP_FUNC) {
+			return !(regs & BRANCH_LIVE);
+		}
+		regs &= ~inst_writes(inst);
+		if (!regs) {
+			return true;
+		}
+		if (inst->op == OP_RET) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool is_reg(Operand *opd, Reg reg) {
+	return opd->kind == OPD_REG && opd->reg == reg;
+}
+
+static bool same_operand(Operand *a, Operand *b) {
+	return a->kind == b->kind && a->reg == b->reg && a->val == b->val &&
+		a->index == b->index && a->scale == b->scale;
+}
+
+static bool fits_imm32(int64_t val) {
+	return val == (int32_t)val;
+}
+
+// 書き込み先がrsp, rbpの命令は消さない
+static bool is_frame_reg(Operand *opd) {
+	return is_reg(opd, REG_RSP) || is_reg(opd, REG_RBP);
+}
+
+// insts[i]の次の消されていない命令の位置
+static int next_inst(int i) {
+	for (i++; i < insts_len && insts[i].op == NUM_OPS; i++)
+		;
+	return i;
+}
+
+// insts[i]と次の命令にパターンを適用する
+// 適用したパターンを返し，どれも当てはまらなければ-1を返す
+// 消す命令はopをNUM_OPSにする
+static int match(int i) {
+	Inst *a = &insts[i];
+	int j = next_inst(i);
+	Inst *b = j < insts_len ? &insts[j] : NULL;
+
+	if (a->op == OP_MOV && same_operand(&a->dst, &a->src)) {
+		a->op = NUM_OPS;
+		return PH_SELF_MOVE;
+	}
+
+	if ((a->op == OP_MOV || a->op == OP_LEA || a->op == OP_MOVZB) &&
+		a->dst.kind == OPD_REG && !is_frame_reg(&a->dst) && is_dead(i + 1, BIT(a->dst.reg))) {
+		a->op = NUM_OPS;
+		return PH_DEAD_MOVE;
+	}
+
+	if (!b) {
+		return -1;
+	}
+
+	if (a->op == OP_PUSH && b->op == OP_POP && a->dst.kind == OPD_REG) {
+		b->op = OP_MOV;
+		b->src = a->dst;
+		a->op = NUM_OPS;
+		return PH_PUSH_POP;
+	}
+
+	if ((a->op != OP_MOV && a->op != OP_MOVZB) || a->dst.kind != OPD_REG) {
+		// add A, B; mov B, A => add B, A
+		if ((a->op == OP_ADD || a->op == OP_IMUL) && a->dst.kind == OPD_REG && a->src.kind == OPD_REG &&
+			b->op == OP_MOV && is_reg(&b->dst, a->src.reg) && is_reg(&b->src, a->dst.reg) &&
+			is_dead(j + 1, BIT(a->dst.reg))) {
+			Operand t = a->dst;
+			a->dst = a->src;
+			a->src = t;
+			b->op = NUM_OPS;
+			return PH_COMMUTE;
+		}
+
+		// lea A, [m]; mov B, [A] => mov B, [m]
+		if (a->op == OP_LEA && a->dst.kind == OPD_REG && b->op == OP_MOV &&
+			b->src.kind == OPD_MEM && b->src.reg == a->dst.reg && !b->src.scale && b->src.val == 0 &&
+			(b->dst.reg == a->dst.reg || is_dead(j + 1, BIT(a->dst.reg)))) {
+			b->src = a->src;
+			a->op = NUM_OPS;
+			return PH_ADDR_FOLD;
+		}
+		return -1;
+	}
+
+	// ここからaはmov A, Xかmovzb A, X
+	Reg ra = a->dst.reg;
+	bool b_reads_a = (b->op == OP_MOV || b->op == OP_ADD || b->op == OP_SUB ||
+		b->op == OP_IMUL || b->op == OP_AND || b->op == OP_CMP) && is_reg(&b->src, ra);
+	if (!b_reads_a || operand_addr_uses(&b->dst) & BIT(ra) || is_reg(&b->dst, ra)) {
+		return -1;
+	}
+	if (!is_dead(j + 1, BIT(ra))) {
+		return -1;
+	}
+
+	// mov A, X; mov B, A => mov B, X
+	if (b->op == OP_MOV && (b->dst.kind == OPD_REG || (a->op == OP_MOV && a->src.kind == OPD_REG))) {
+		b->op = a->op;
+		b->src = a->src;
+		a->op = NUM_OPS;
+		return PH_COPY;
+	}
+
+	if (a->op != OP_MOV) {
+		return -1;
+	}
+
+	// mov A, imm; op B, A => op B, imm
+	if (a->src.kind == OPD_IMM && fits_imm32(a->src.val)) {
+		b->src = a->src;
+		a->op = NUM_OPS;
+		return PH_IMM_OPERAND;
+	}
+
+	// mov A, [m]; op B, A => op B, [m]
+	// メモリ同士の演算はできない
+	if (a->src.kind == OPD_MEM && b->dst.kind == OPD_REG && b->op != OP_MOV) {
+		b->src = a->src;
+		a->op = NUM_OPS;
+		return PH_MEM_OPERAND;
+	}
+	return -1;
+}
+
+// 消した命令を詰める
+static void compact() {
+	int j = 0;
+	for (int i = 0; i < insts_len; i++) {
+		if (insts[i].op != NUM_OPS) {
+			insts[j++] = insts[i];
+		}
+	}
+	insts_len = j;
+}
+
+// 命令列に覗き穴最適化を施す
+// 当てはまるパターンがなくなるまで繰り返す
+void peephole() {
+	bool changed = true;
+	while (changed) {
+		changed = false;
+		for (int i = 0; i < insts_len; i++) {
+			if (insts[i].op == NUM_OPS) {
+				continue;
+			}
+			int p = match(i);
+			if (p >= 0) {
+				ctx->pattern_hits[p]++;
+				changed = true;
+			}
+		}
+		compact();
+	}
+}
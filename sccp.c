@@ -0,0 +1,344 @@
+// sccp.c
+// 疎な条件付き定数伝播(Wegman-Zadeck)
+
+#include "9cc.h"
+
+// 値の束
+enum {
+	LAT_TOP,	// まだ分からない
+	LAT_CONST,	// 定数
+	LAT_BOTTOM,	// 定数ではない
+};
+
+static _Thread_local unsigned char *lat;
+static _Thread_local int64_t *lat_val;
+
+// 辺(前任ブロックの番号ごと)が実行されうるかどうか
+// ブロックのmarkを辺の表の先頭の添字にする
+static _Thread_local bool *edge_exec;
+
+// ブロックが実行されうるかどうか(添字はブロックの番号 - block_base)
+static _Thread_local bool *block_exec;
+static _Thread_local int block_base;
+
+// 値を使う命令(値の番号ごとにuse_start[id]からuse_start[id + 1]まで)
+static _Thread_local int *use_start;
+static _Thread_local IrInst **users;
+
+// 作業リスト
+static _Thread_local IrInst **inst_work;
+static _Thread_local int inst_work_len, inst_work_cap;
+
+typedef struct {
+	IrBlock *from, *to;
+} Edge;
+
+static _Thread_local Edge *edge_work;
+static _Thread_local int edge_work_len, edge_work_cap;
+
+static void push_inst(IrInst *inst) {
+	if (inst_work_len == inst_work_cap) {
+		inst_work_cap = inst_work_cap ? inst_work_cap * 2 : 256;
+		inst_work = realloc(inst_work, sizeof(IrInst *) * inst_work_cap);
+		if (!inst_work) {
+			error("メモリが足りません");
+		}
+	}
+	inst_work[inst_work_len++] = inst;
+}
+
+static void push_edge(IrBlock *from, IrBlock *to) {
+	if (edge_work_len == edge_work_cap) {
+		edge_work_cap = edge_work_cap ? edge_work_cap * 2 : 64;
+		edge_work = realloc(edge_work, sizeof(Edge) * edge_work_cap);
+		if (!edge_work) {
+			error("メモリが足りません");
+		}
+	}
+	edge_work[edge_work_len++] = (Edge){from, to};
+}
+
+static int lattice(IrInst *inst) {
+	return inst->op == IR_IMM ? LAT_CONST : lat[inst->id];
+}
+
+static int64_t const_val(IrInst *inst) {
+	return inst->op == IR_IMM ? inst->val : lat_val[inst->id];
+}
+
+// 値を束の下の方へ動かし，変われば使う命令を作業リストに積む
+static void update(IrInst *inst, int state, int64_t val) {
+	if (lat[inst->id] == state && (state != LAT_CONST || lat_val[inst->id] == val)) {
+		return;
+	}
+	lat[inst->id] = state;
+	lat_val[inst->id] = val;
+	for (int i = use_start[inst->id]; i < use_start[inst->id + 1]; i++) {
+		push_inst(users[i]);
+	}
+}
+
+// 定数同士の演算を計算する．計算できなければ偽を返す
+// 実行時と同じく64ビットで桁あふれさせる
+static bool eval(IrOp op, int64_t l, int64_t r, int64_t *val) {
+	switch (op) {
+	case IR_ADD: *val = (int64_t)((uint64_t)l + (uint64_t)r); return true;
+	case IR_SUB: *val = (int64_t)((uint64_t)l - (uint64_t)r); return true;
+	case IR_MUL: *val = (int64_t)((uint64_t)l * (uint64_t)r); return true;
+	case IR_DIV:
+		if (r == 0 || (l == INT64_MIN && r == -1)) {
+			return false;
+		}
+		*val = l / r;
+		return true;
+	case IR_EQ: *val = l == r; return true;
+	case IR_NE: *val = l != r; return true;
+	case IR_LT: *val = l < r; return true;
+	case IR_LE: *val = l <= r; return true;
+	default:
+		return false;
+	}
+}
+
+static void visit_phi(IrInst *phi) {
+	IrBlock *block = phi->block;
+	int state = LAT_TOP;
+	int64_t val = 0;
+
+	for (int i = 0; i < phi->nargs; i++) {
+		if (!edge_exec[block->mark + i]) {
+			continue;
+		}
+		IrInst *arg = phi->args[i];
+		int s = lattice(arg);
+		if (s == LAT_TOP) {
+			continue;
+		}
+		if (s == LAT_BOTTOM || (state == LAT_CONST && val != const_val(arg))) {
+			state = LAT_BOTTOM;
+			break;
+		}
+		state = LAT_CONST;
+		val = const_val(arg);
+	}
+	update(phi, state, val);
+}
+
+static void visit(IrInst *inst) {
+	IrBlock *block = inst->block;
+	IrInst *l, *r;
+	int64_t val;
+
+	switch (inst->op) {
+	case IR_PHI:
+		visit_phi(inst);
+		return;
+	case IR_COPY:
+		l = inst->args[0];
+		update(inst, lattice(l), lattice(l) == LAT_CONST ? const_val(l) : 0);
+		return;
+	case IR_ADD:
+	case IR_SUB:
+	case IR_MUL:
+	case IR_DIV:
+	case IR_EQ:
+	case IR_NE:
+	case IR_LT:
+	case IR_LE:
+		l = inst->args[0];
+		r = inst->args[1];
+		if (lattice(l) == LAT_BOTTOM || lattice(r) == LAT_BOTTOM) {
+			update(inst, LAT_BOTTOM, 0);
+		}
+		else if (lattice(l) == LAT_CONST && lattice(r) == LAT_CONST) {
+			if (eval(inst->op, const_val(l), const_val(r), &val)) {
+				update(inst, LAT_CONST, val);
+			}
+			else {
+				update(inst, LAT_BOTTOM, 0);
+			}
+		}
+		return;
+	case IR_JMP:
+		push_edge(block, block->succ[0]);
+		return;
+	case IR_BR:
+		l = inst->args[0];
+		if (lattice(l) == LAT_TOP) {
+			return;
+		}
+		if (lattice(l) == LAT_BOTTOM || const_val(l)) {
+			push_edge(block, block->succ[0]);
+		}
+		if (lattice(l) == LAT_BOTTOM || !const_val(l)) {
+			push_edge(block, block->succ[1]);
+		}
+		return;
+	case IR_STOREVAR:
+	case IR_RET:
+		return;
+	default:
+		// 引数，関数の返り値，メモリの値などは定数とみなさない
+		update(inst, LAT_BOTTOM, 0);
+	}
+}
+
+// 値を使う命令の表を作る
+static void build_users(IrFunc *fn) {
+	use_start = calloc(fn->nvalues + 2, sizeof(int));
+	if (!use_start) {
+		error("メモリが足りません");
+	}
+
+	int total = 0;
+	for (IrBlock *b = fn->blocks; b; b = b->next) {
+		for (IrInst *inst = b->first; inst; inst = inst->next) {
+			for (int i = 0; i < inst->nargs; i++) {
+				use_start[inst->args[i]->id + 2]++;
+				total++;
+			}
+		}
+	}
+	for (int i = 2; i < fn->nvalues + 2; i++) {
+		use_start[i] += use_start[i - 1];
+	}
+
+	users = malloc(sizeof(IrInst *) * (total + 1));
+	if (!users) {
+		error("メモリが足りません");
+	}
+	for (IrBlock *b = fn->blocks; b; b = b->next) {
+		for (IrInst *inst = b->first; inst; inst = inst->next) {
+			for (int i = 0; i < inst->nargs; i++) {
+				users[use_start[inst->args[i]->id + 1]++] = inst;
+			}
+		}
+	}
+}
+
+// 分岐をジャンプに置き換え，使わなくなった辺を除く
+static void fold_branch(IrBlock *block, bool taken) {
+	IrInst *br = block->last;
+	IrBlock *dead = block->succ[taken ? 1 : 0];
+
+	br->op = IR_JMP;
+	br->nargs = 0;
+	block->succ[0] = block->succ[taken ? 0 : 1];
+	block->succ[1] = NULL;
+
+	// deadの前任ブロックからblockを除く
+	for (int i = 0; i < dead->npreds; i++) {
+		if (dead->preds[i] != block) {
+			continue;
+		}
+		for (int j = i + 1; j < dead->npreds; j++) {
+			dead->preds[j - 1] = dead->preds[j];
+		}
+		for (IrInst *phi = dead->first; phi && phi->op == IR_PHI; phi = phi->next) {
+			for (int j = i + 1; j < phi->nargs; j++) {
+				phi->args[j - 1] = phi->args[j];
+			}
+			phi->nargs--;
+		}
+		dead->npreds--;
+		break;
+	}
+	ctx->sccp_branches++;
+}
+
+// 疎な条件付き定数伝播
+// 定数と分かった値を使う命令の引数を定数に置き換え，
+// 条件が定数の分岐をジャンプにする
+void sccp(IrFunc *fn) {
+	int max_id = 0, nedges = 0;
+	for (IrBlock *b = fn->blocks; b; b = b->next) {
+		b->mark = nedges;
+		nedges += b->npreds;
+		if (b->id > max_id) {
+			max_id = b->id;
+		}
+	}
+	block_base = fn->blocks->id;
+
+	lat = calloc(fn->nvalues, 1);
+	lat_val = calloc(fn->nvalues, sizeof(int64_t));
+	edge_exec = calloc(nedges + 1, sizeof(bool));
+	block_exec = calloc(max_id - block_base + 1, sizeof(bool));
+	if (!lat || !lat_val || !edge_exec || !block_exec) {
+		error("メモリが足りません");
+	}
+	build_users(fn);
+
+	// 入口から始める
+	push_edge(NULL, fn->blocks);
+	while (edge_work_len || inst_work_len) {
+		while (edge_work_len) {
+			Edge e = edge_work[--edge_work_len];
+			IrBlock *to = e.to;
+			if (e.from) {
+				bool found = false;
+				for (int i = 0; i < to->npreds; i++) {
+					if (to->preds[i] == e.from && !edge_exec[to->mark + i]) {
+						edge_exec[to->mark + i] = true;
+						found = true;
+					}
+				}
+				if (!found) {
+					continue;
+				}
+			}
+
+			if (block_exec[to->id - block_base]) {
+				// phiだけ調べ直す
+				for (IrInst *phi = to->first; phi && phi->op == IR_PHI; phi = phi->next) {
+					visit_phi(phi);
+				}
+				continue;
+			}
+			block_exec[to->id - block_base] = true;
+			for (IrInst *inst = to->first; inst; inst = inst->next) {
+				visit(inst);
+			}
+		}
+
+		while (inst_work_len) {
+			IrInst *inst = inst_work[--inst_work_len];
+			if (inst->block && block_exec[inst->block->id - block_base]) {
+				visit(inst);
+			}
+		}
+	}
+
+	// 定数になった値をphi以外の引数で置き換える
+	// phiの引数は同じ変数の値でなければならないので残す
+	for (IrBlock *b = fn->blocks; b; b = b->next) {
+		if (!block_exec[b->id - block_base]) {
+			continue;
+		}
+		for (IrInst *inst = b->first; inst; inst = inst->next) {
+			if (inst->op == IR_PHI) {
+				continue;
+			}
+			for (int i = 0; i < inst->nargs; i++) {
+				IrInst *arg = inst->args[i];
+				if (arg->op != IR_IMM && lat[arg->id] == LAT_CONST) {
+					inst->args[i] = ir_imm(fn, lat_val[arg->id]);
+					ctx->sccp_consts++;
+				}
+			}
+		}
+		if (b->last->op == IR_BR && b->last->args[0]->op == IR_IMM) {
+			fold_branch(b, b->last->args[0]->val != 0);
+		}
+	}
+
+	free(lat);
+	free(lat_val);
+	free(edge_exec);
+	free(block_exec);
+	free(use_start);
+	free(users);
+
+	remove_unreachable(fn);
+	simplify_phis(fn);
+}
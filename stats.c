@@ -0,0 +1,135 @@
+// stats.c
+// 統計の表示と，段階ごとの時間の計測(--stats, --trace)
+
+#include "9cc.h"
+
+static char *phase_names[] = {
+	[PHASE_TOKENIZE] = "tokenize",
+	[PHASE_PARSE] = "parse",
+	[PHASE_FOLD] = "fold",
+	[PHASE_IR] = "ir",
+	[PHASE_CODEGEN] = "codegen",
+	[PHASE_OUTPUT] = "output",
+};
+
+static char *node_kind_names[] = {
+	[ND_ADD] = "add", [ND_SUB] = "sub", [ND_MUL] = "mul", [ND_DIV] = "div",
+	[ND_NUM] = "num", [ND_EQ] = "eq", [ND_NEQ] = "neq", [ND_LEQ] = "leq",
+	[ND_LE] = "le", [ND_ASSIGN] = "assign", [ND_LVAR] = "lvar", [ND_RETURN] = "return",
+	[ND_IF] = "if", [ND_WHILE] = "while", [ND_FOR] = "for", [ND_BLOCK] = "block",
+	[ND_FUNCALL] = "funcall", [ND_FUNC] = "func", [ND_ADDR] = "addr", [ND_DEREF] = "deref",
+};
+
+double end_phase(Phase p, double start) {
+	double end = now();
+	ctx->phase_time[p] += end - start;
+	if (ctx->opt_trace) {
+		add_span("phase", phase_names[p], strlen(phase_names[p]), 0, start, end);
+	}
+	return end;
+}
+
+void add_span(char *cat, char *name, int len, int tid, double start, double end) {
+	if (ctx->spans_len == ctx->spans_cap) {
+		ctx->spans_cap = ctx->spans_cap ? ctx->spans_cap * 2 : 256;
+		ctx->spans = realloc(ctx->spans, sizeof(Span) * ctx->spans_cap);
+		if (!ctx->spans) {
+			error("メモリが足りません");
+		}
+	}
+	ctx->spans[ctx->spans_len++] = (Span){cat, name, len, tid, start, end};
+}
+
+void print_stats(Context *c) {
+	double total = 0;
+	for (int i = 0; i < NUM_PHASES; i++) {
+		total += c->phase_time[i];
+	}
+	for (int i = 0; i < NUM_PHASES; i++) {
+		fprintf(stderr, "time %s: %.3f ms (%.1f%%)\n", phase_names[i], c->phase_time[i] * 1e3,
+				total > 0 ? c->phase_time[i] / total * 100 : 0.0);
+	}
+	fprintf(stderr, "time total: %.3f ms\n", total * 1e3);
+
+	fprintf(stderr, "tokens: %d\n", c->tokens_len);
+	fprintf(stderr, "bytes/token: %zu\n", sizeof(Token));
+	fprintf(stderr, "token buffer: %zu bytes, %d allocations\n",
+			sizeof(Token) * c->tokens_len, c->token_allocs);
+	fprintf(stderr, "nodes: %d, node pool: %zu bytes (%.1f bytes/node)\n",
+			c->node_count_total, sizeof(uint32_t) * c->node_pool_len,
+			c->node_count_total ? (double)sizeof(uint32_t) * c->node_pool_len / c->node_count_total : 0.0);
+	for (int i = 0; i < NUM_NODE_KINDS; i++) {
+		if (c->node_kinds[i]) {
+			fprintf(stderr, "nodes %s: %d\n", node_kind_names[i], c->node_kinds[i]);
+		}
+	}
+	fprintf(stderr, "functions: %d\n", c->func_count);
+	fprintf(stderr, "locals: %d\n", c->lvar_count);
+	fprintf(stderr, "folded: %d\n", c->fold_count);
+	fprintf(stderr, "arena: %zu bytes used, %zu bytes high water, %zu bytes reserved\n",
+			c->arena.used, c->arena.high_water, c->arena.reserved);
+
+	double codegen_time = c->phase_time[PHASE_IR] + c->phase_time[PHASE_CODEGEN] + c->phase_time[PHASE_OUTPUT];
+	fprintf(stderr, "codegen: %zu bytes in %.3f ms (%.1f MB/s)\n",
+			c->emit_total, codegen_time * 1e3,
+			codegen_time > 0 ? c->emit_total / codegen_time / 1e6 : 0.0);
+	fprintf(stderr, "ir: %d blocks, %d values\n", c->ir_blocks_total, c->ir_values_total);
+	fprintf(stderr, "inlined: %d calls\n", c->inline_count);
+	if (c->opt_sccp) {
+		fprintf(stderr, "sccp: %d constants, %d branches\n", c->sccp_consts, c->sccp_branches);
+	}
+	fprintf(stderr, "dce: %d removed\n", c->dce_removed);
+	if (c->opt_licm) {
+		fprintf(stderr, "licm: %d hoisted\n", c->licm_hoisted);
+	}
+	if (c->opt_tailcall) {
+		fprintf(stderr, "tail calls: %d loops, %d jumps\n", c->tail_loops, c->tail_jumps);
+	}
+	fprintf(stderr, "strength reduced: %d\n", c->strength_reduced);
+	fprintf(stderr, "instructions: %ld\n", c->insts_total);
+	if (c->opt_object) {
+		fprintf(stderr, "text: %d bytes, %d calls\n", c->text_len, c->obj_calls_len);
+	}
+	if (c->cache_dir) {
+		fprintf(stderr, "cache: %d hits, %d misses\n", c->cache_hits, c->cache_misses);
+	}
+	if (c->opt_peephole) {
+		print_peephole_stats(c);
+	}
+
+	// 確保した主な領域の大きさ
+	size_t tokens = sizeof(Token) * c->tokens_cap;
+	size_t nodes = sizeof(uint32_t) * c->node_pool_cap;
+	size_t output = (c->out ? c->out->cap : 0) + c->text_cap;
+	fprintf(stderr, "allocated: tokens %zu, nodes %zu, arena %zu, codegen %zu, output %zu, total %zu bytes\n",
+			tokens, nodes, c->arena.reserved, c->codegen_bytes, output,
+			tokens + nodes + c->arena.reserved + c->codegen_bytes + output);
+}
+
+bool write_trace(Context *c, char *path) {
+	FILE *fp = fopen(path, "w");
+	if (!fp) {
+		return false;
+	}
+
+	// 時刻はcompileを始めてからのマイクロ秒
+	int max_tid = 0;
+	fprintf(fp, "{\"traceEvents\":[\n");
+	for (int i = 0; i < c->spans_len; i++) {
+		Span *s = &c->spans[i];
+		fprintf(fp, "{\"name\":\"%.*s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%d},\n",
+				s->len, s->name, s->cat,
+				(s->start - c->start_time) * 1e6, (s->end - s->start) * 1e6, s->tid);
+		if (s->tid > max_tid) {
+			max_tid = s->tid;
+		}
+	}
+	for (int tid = 0; tid <= max_tid; tid++) {
+		fprintf(fp, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s %d\"}}%s\n",
+				tid, tid ? "codegen" : "main", tid, tid < max_tid ? "," : "");
+	}
+	fprintf(fp, "]}\n");
+
+	bool ok = !ferror(fp);
+	return !fclose(fp) && ok;
+}
@@ -0,0 +1,168 @@
+// tailcall.c
+// 末尾呼び出しの最適化
+
+#include "9cc.h"
+
+// 関数自身を呼び出して，その値をそのまま返す命令か
+static bool is_self_tail_call(IrFunc *fn, IrInst *ret) {
+	IrInst *call = ret->prev;
+	if (ret->op != IR_RET || !call || call != ret->args[0] || call->op != IR_CALL) {
+		return false;
+	}
+	Func *callee = find_func(&ctx->tokens[call->val]);
+	return callee && callee->node == fn->node && callee->nparams == call->nargs;
+}
+
+// 引数を受け取る命令か(入口のブロックの先頭に並ぶ)
+static bool is_prologue(IrInst *inst) {
+	return inst->op == IR_UNDEF || inst->op == IR_PARAM ||
+		(inst->op == IR_STOREVAR && inst->args[0]->op == IR_PARAM);
+}
+
+// 自己再帰の末尾呼び出しを，引数を入れ替えて関数の先頭へ戻るループにする
+// 引数を受け取った直後にループの先頭のブロックを置き，引数の変数のphiで合流させる
+// 前の回の変数を指すポインタがあると次の回で書き換わってしまうので，アドレスを取る関数ではしない
+void tail_recursion(IrFunc *fn) {
+	int ntails = 0;
+	for (IrBlock *b = fn->blocks; b; b = b->next) {
+		for (IrInst *inst = b->first; inst; inst = inst->next) {
+			if (inst->op == IR_ADDR) {
+				return;
+			}
+		}
+		ntails += is_self_tail_call(fn, b->last);
+	}
+	if (!ntails) {
+		return;
+	}
+
+	// 入口のブロックを引数を受け取った直後で分ける
+	IrBlock *entry = fn->blocks;
+	IrInst *split = entry->first;
+	while (is_prologue(split)) {
+		split = split->next;
+	}
+	IrBlock *header = ir_new_block(fn, entry);
+
+	// 引数の変数ごとにphiを置く．アドレスを取られた引数は変数の番号を覚えておく
+	int nparams = node_count(fn->node);
+	IrInst **phis = calloc(nparams, sizeof(IrInst *));
+	int *stores = calloc(nparams, sizeof(int));
+	if (!phis || !stores) {
+		error("メモリが足りません");
+	}
+	for (IrInst *inst = entry->first; inst != split; inst = inst->next) {
+		if (inst->op == IR_STOREVAR) {
+			stores[inst->args[0]->val] = inst->val;
+		}
+		if (inst->op != IR_PARAM || !inst->var) {
+			continue;
+		}
+		IrInst *phi = ir_new_inst(fn, IR_PHI, ntails + 1);
+		phi->var = inst->var;
+		phi->nargs = 1;
+		phi->args[0] = inst;
+		ir_append(header, phi);
+		phis[inst->val] = phi;
+	}
+
+	// 残りの命令をループの先頭に移す
+	IrInst *last = entry->last;
+	entry->last = split->prev;
+	if (entry->last) {
+		entry->last->next = NULL;
+	}
+	else {
+		entry->first = NULL;
+	}
+	split->prev = header->last;
+	if (header->last) {
+		header->last->next = split;
+	}
+	else {
+		header->first = split;
+	}
+	header->last = last;
+	for (IrInst *inst = split; inst; inst = inst->next) {
+		inst->block = header;
+	}
+
+	for (int i = 0; i < 2; i++) {
+		header->succ[i] = entry->succ[i];
+		entry->succ[i] = NULL;
+		if (header->succ[i]) {
+			for (int j = 0; j < header->succ[i]->npreds; j++) {
+				if (header->succ[i]->preds[j] == entry) {
+					header->succ[i]->preds[j] = header;
+				}
+			}
+		}
+	}
+	ir_append(entry, ir_new_inst(fn, IR_JMP, 0));
+	entry->succ[0] = header;
+	ir_add_pred(header, entry);
+
+	// ループの中では引数の代わりにphiを使う
+	for (IrBlock *b = header; b; b = b->next) {
+		for (IrInst *inst = b->first; inst; inst = inst->next) {
+			if (inst->op == IR_PHI && inst->block == header) {
+				continue;
+			}
+			for (int i = 0; i < inst->nargs; i++) {
+				IrInst *arg = inst->args[i];
+				if (arg->op == IR_PARAM && arg->var) {
+					inst->args[i] = phis[arg->val];
+				}
+			}
+		}
+	}
+
+	// 末尾呼び出しを，引数の変数への代入とループの先頭へのジャンプにする
+	for (IrBlock *b = header; b; b = b->next) {
+		IrInst *ret = b->last;
+		if (!is_self_tail_call(fn, ret)) {
+			continue;
+		}
+		IrInst *call = ret->prev;
+		ir_remove(ret);
+		ir_remove(call);
+
+		// 前の引数の変数の値は，その変数に代入すると変わるので一時的な値に移す
+		IrInst **args = call->args;
+		for (int i = 0; i < nparams; i++) {
+			bool clobbered = false;
+			for (int k = 0; k < i; k++) {
+				clobbered |= phis[k] && args[i]->var == phis[k]->var;
+			}
+			if (args[i]->op != IR_IMM && clobbered) {
+				IrInst *copy = ir_new_inst(fn, IR_COPY, 1);
+				copy->args[0] = args[i];
+				ir_append(b, copy);
+				args[i] = copy;
+			}
+		}
+		for (int i = 0; i < nparams; i++) {
+			if (phis[i]) {
+				IrInst *copy = ir_new_inst(fn, IR_COPY, 1);
+				copy->var = phis[i]->var;
+				copy->args[0] = args[i];
+				ir_append(b, copy);
+				phis[i]->args[phis[i]->nargs++] = copy;
+			}
+			else {
+				IrInst *store = ir_new_inst(fn, IR_STOREVAR, 1);
+				store->val = stores[i];
+				store->args[0] = args[i];
+				ir_append(b, store);
+			}
+		}
+
+		ir_append(b, ir_new_inst(fn, IR_JMP, 0));
+		b->succ[0] = header;
+		ir_add_pred(header, b);
+		ctx->tail_loops++;
+	}
+
+	free(phis);
+	free(stores);
+}
@@ -1,18 +1,54 @@
 #!/bin/bash
+# 使い方: ./test.sh [--run]
+# --runならアセンブラとリンカを使わず，9cc --runで実行した結果だけを確かめる
+quick="$1"
+
 assert() {
     expected="$1"
     input="$2"
 
+    ./9cc --run "$input"
+    actual="$?"
+    if [ "$quick" = "--run" ]; then
+        if [ "$actual" != "$expected" ]; then
+            echo "$input => $expected expected, but got $actual"
+            exit 1
+        fi
+        return
+    fi
+    actual_run="$actual"
+
     ./9cc "$input" > tmp.s
+    # スレッドの数によらず同じアセンブリになるか
+    for threads in 1 4; do
+        if ! ./9cc --threads=$threads "$input" | cmp -s - tmp.s; then
+            echo "$input => output differs with --threads=$threads"
+            exit 1
+        fi
+    done
     cc -o tmp tmp.s
     ./tmp
     actual="$?"
 
+    # -cで直接出力したオブジェクトも同じ結果になるか
+    ./9cc -c "$input" > tmp.o
+    cc -o tmp tmp.o
+    ./tmp
+    actual_obj="$?"
+    if [ "$actual_obj" != "$actual" ]; then
+        echo "$input => $actual with assembly, but $actual_obj with -c"
+        exit 1
+    fi
+    if [ "$actual_run" != "$actual" ]; then
+        echo "$input => $actual with assembly, but $actual_run with --run"
+        exit 1
+    fi
+
     if [ "$actual" = "$expected" ]; then
         echo "$input => $actual"
     else
         echo "$input => $expected expected, but got $actual"
-        exit 
+        exit 1
     fi
 }
 
@@ -69,4 +105,148 @@ assert 5 "int bar(int i, int j) {return i + j;} int main() {int i; int j; i = 11
 
 assert 3 "int main() {int x; int y; x = 3; y = &x; return *y;}"
 
+assert 6 "int main() {int iffy; int return_2; iffy = 2; return_2 = 3; return iffy * return_2;}"
+assert 7 "$(printf 'int main() {\n\tint x;\n\n    x = 7;          return x;\n}')"
+assert 1 "int main() {int a; a = 1; {int a; a = 5;} return a;}"
+assert 6 "int main() {int a; a = 1; {int b; b = 5; a = a + b;} return a;}"
+assert 5 "int main() {return g(4);} int g(int x) {return x + 1;}"
+assert 47 "int main() {return 5+6*7;}"
+assert 3 "int foo() {return 2;} int main() {return 1 + foo();}"
+assert 55 "int fib(int n) {if (n < 2) return n; return fib(n-1) + fib(n-2);} int main() {return fib(10);}"
+assert 250 "int main() {return ((1+2)*(3+4)+(5+6)*(7+8))/((1+1)*(2+2)+(3+3)*(4+4)-(1+(2+(3+(4+5)))))-10;}"
+assert 8 "int f(int a, int b, int c, int d, int e, int g) {return a-b+c-d+e*g;} int main() {return f(1+1,(2+2)*(1+0),(3+3)*(1+1)/(1+1),4,(5-1)*(1+1)/(1+1),(1+1)*(0+1));}"
+assert 15 "int main() {int a; int b; a = 3; b = 4; return *&a + b * a;}"
+assert 1 "int main() {int a; int b; int c; a = 10; b = 3; c = 3; return a - b * c;}"
+assert 17 "int main() {return 3*4+5;}"
+assert 7 "int main() {int x; x = 7; return 0-(0-x)*1+0;}"
+assert 5 "int main() {int x; x = 2; if (1) x = 5; else x = 6; return x;}"
+assert 10 "int main() {int x; x = 2; while (1) {x = x + 1; if (x == 10) return x;}}"
+assert 1 "int main() {int i; for (i = 0; 0; i = i + 1) return 7; return i + 1;}"
+assert 0 "int main() {int x; x = 3; 5; if (0) 3;}"
+assert 5 "int main() {int x; x = 0; return (x = 5) * 0 + x;}"
+assert 5 "int main() {int x; int y; x = 3; y = &x; x = 5; return *y;}"
+assert 20 "int main() {int i; int s; s = 0; for (i = 0; i < 10; i = i + 1) {if (i == 5) s = s + 10; s = s + 1;} return s;}"
+assert 4 "int main() {int i; int j; int s; s = 0; for (i = 0; i < 4; i = i + 1) for (j = 0; j < i; j = j + 1) s = s + j; return s;}"
+assert 0 "int main() {int x; x = 1; while (x < 100) x = x * 3;}"
+assert 7 "int f(int a) {int b; b = &a; return *b + 2;} int main() {return f(5);}"
+
+assert 3 "int main() {int x; int n; n = 0; for (x = 0; x < 6; x = x + 1) {if (2 < x) n = n + 1; if (3 == x) n = n + 0; else if (x <= 4) n = n;} return n + (x == 6) - 1;}"
+assert 1 "int f(int x) {if (x == 5) 1; else 2;} int main() {return f(5);}"
+
+assert 124 "int f(int n, int m) {int i; int j; int s; s = 0; for (i = 0; i < n; i = i + 1) for (j = 0; j < m; j = j + 1) s = s + i * m + n * m * 3 + j; return s;} int main() {return f(10, 20);}"
+assert 73 "int f(int n) {int i; int s; int a; s = 0; a = 8; for (i = 0; i < 5; i = i + 1) {s = s + n * 7 / 3 + a; if (i == 2) a = 2;} return s;} int main() {return f(4);}"
+assert 0 "int f(int n) {int i; int s; s = 0; for (i = 0; i < n; i = i + 1) s = s + 5 / n; return s;} int main() {return f(0);}"
+assert 54 "int sq(int x) {return x * x;} int ab(int x) {if (x < 0) return 0 - x; return x;} int f(int n) {int i; int s; s = 0; for (i = 0; i < n; i = i + 1) s = s + sq(i) + ab(i - 5); return s;} int main() {return f(10);}"
+assert 1 "int ev(int n) {if (n == 0) return 1; return od(n - 1);} int od(int n) {if (n == 0) return 0; return ev(n - 1);} int main() {return ev(10);}"
+assert 24 "int g(int a) {int b; int i; b = &a; for (i = 0; i < 3; i = i + 1) a = a + i; return *b;} int main() {int i; int x; x = 0; for (i = 0; i < 3; i = i + 1) x = x + g(i) + g(1); return x;}"
+assert 33 "int sq(int x) {return x * x;} int h(int x) {x * 2;} int main() {return sq(sq(2)) + sq(3) + h(4);}"
+assert 64 "int sum(int n, int acc) {if (n == 0) return acc; return sum(n - 1, acc + n);} int main() {return sum(10000000, 0);}"
+assert 0 "int ev(int n) {if (n == 0) return 1; return od(n - 1);} int od(int n) {if (n == 0) return 0; return ev(n - 1);} int main() {return ev(1000001);}"
+assert 37 "int f(int a, int b, int c) {if (a == 0) return b * 10 + c; return f(a - 1, c, b);} int main() {return f(5, 7, 3);}"
+# アドレスを取る関数では，自己再帰の末尾呼び出しもループにしない
+assert 1 "int f(int n, int p) {if (n == 0) return *p; return f(n - 1, &n);} int main() {int y; y = 7; return f(2, &y);}"
+assert 1 "int f(int n, int p) {int x; x = n; if (n == 0) return *p; return f(n - 1, &x);} int main() {int y; y = 7; return f(2, &y);}"
+assert 43 "int g(int p, int k) {int i; int s; s = 0; for (i = 0; i < k; i = i + 1) {if (i == 2) s = s + 1; else if (i == 3) s = s - 1; s = s + i * 2 - i;} return s + *p;} int f(int a) {int b; b = &a; return g(b, 4);} int main() {return f(37);}"
+# 呼び出し先のローカル変数のアドレスから，呼び出しの時にrspが16の倍数だったかを調べる
+# (退避するレジスタが奇数個の関数や，ローカル変数の多い関数からも呼び出す)
+aligned="int aligned(int a, int b) {int x; int p; p = &x; if (a * b + (a - b) * (a + b) * (a * a - b * b) == 12345) return a * b - (a + b) * (a - b); return p - p / 16 * 16 == 8;}"
+assert 3 "$aligned int main() {int a; a = aligned(0, 0); return aligned(0, 0) * 2 + a;}"
+assert 16 "$aligned int main() {return (aligned(0, 0) + 1) * (aligned(0, 0) + 2) * (aligned(0, 0) + 3) * ((aligned(0, 0) + 4) * (aligned(0, 0) + 5) + (aligned(0, 0) + 6) * (aligned(0, 0) + 7));}"
+prog="$aligned int f(int a) {"
+for i in $(seq 0 29); do
+    prog="$prog int v$i; v$i = a + $i;"
+done
+assert 129 "$prog return aligned(0, 0) * 100 + v29 - v0;} int main() {return f(1);}"
+# 定数による乗除算を，割る数をメモリから読んで計算したものと比べる
+divs="$(seq -70 70 | grep -vx 0) 100 641 1000 12345 2147483647 -2147483647-1"
+prog="int dv(int a, int b) {int p; p = &b; return a / *p;} int ml(int a, int b) {int p; p = &b; return a * *p;} int t(int x) {"
+for d in $divs; do
+    prog="$prog if (x / ($d) != dv(x, $d)) return 1; if (x * ($d) != ml(x, $d)) return 1; if (($d) * x != ml(x, $d)) return 1;"
+done
+prog="$prog return 0;} int main() {int x; int i; x = 1; for (i = 0; i < 45; i = i + 1) {if (t(x)) return 1; if (t(0 - x)) return 2; x = x * 3 + 1;} return 0;}"
+assert 0 "$prog"
+
+# intに収まらない数はエラーにする
+for n in 2147483648 4294967297 99999999999; do
+    if ./9cc "int main() {return $n;}" > /dev/null 2>&1; then
+        echo "$n => error expected"
+        exit 1
+    fi
+done
+echo "2147483648 => error"
+
+# ファイルを使う試験の入出力は一時ディレクトリに置く
+# (カレントディレクトリの*.cはMakefileがコンパイラのソースとして拾う)
+dir="$(mktemp -d)"
+trap 'rm -rf "$dir"' EXIT
+
+# ファイルと標準入力から読む．関数定義の数に上限はない
+for i in $(seq 0 999); do
+    echo "int f$i(int x) {return x + $((i % 7));}"
+done > "$dir/a.c"
+echo "int main() {return f999(3) + f1(2);}" >> "$dir/a.c"
+./9cc --run "$dir/a.c"
+actual="$?"
+./9cc --run - < "$dir/a.c"
+actual_stdin="$?"
+if [ "$actual" != 11 ] || [ "$actual_stdin" != 11 ]; then
+    echo "a.c => 11 expected, but got $actual (stdin: $actual_stdin)"
+    exit 1
+fi
+echo "a.c => $actual"
+
+# 呼び出し先が後に定義される長い呼び出しの連なりも，展開するときにCのスタックを使い切らない
+for i in $(seq 49999 -1 1); do
+    echo "int f$i(int x) {return f$((i - 1))(x) + 1;}"
+done > "$dir/chain.c"
+echo "int f0(int x) {return x;} int main() {return f49999(0) - 49990;}" >> "$dir/chain.c"
+./9cc --run "$dir/chain.c"
+actual="$?"
+if [ "$actual" != 9 ]; then
+    echo "chain.c => 9 expected, but got $actual"
+    exit 1
+fi
+echo "chain.c => $actual"
+
+# ファイル名の打ち間違いはプログラムとして読まずにエラーにする
+if ./9cc "$dir/none.c" > /dev/null 2>&1; then
+    echo "none.c => error expected"
+    exit 1
+fi
+echo "none.c => error"
+
+# --batchで複数のファイルを1つのプロセスでコンパイルする．@は一覧のファイル
+if [ "$quick" != "--run" ]; then
+    echo "int main() {return 3;}" > "$dir/b.c"
+    echo "$dir/b.c" > "$dir/list"
+    ./9cc --batch --threads=2 "$dir/a.c" @"$dir/list" 2> /dev/null
+    cc -o tmp "$dir/a.s" && ./tmp
+    actual="$?"
+    cc -o tmp "$dir/b.s" && ./tmp
+    actual2="$?"
+    if [ "$actual" != 11 ] || [ "$actual2" != 3 ]; then
+        echo "--batch => 11 and 3 expected, but got $actual and $actual2"
+        exit 1
+    fi
+    echo "--batch => $actual $actual2"
+
+    # --cacheで変わっていない関数のコードを使い回す．出力はキャッシュなしと同じ
+    ./9cc --cache="$dir/cache" "$dir/a.c" > /dev/null
+    sed -i 's/int f5(int x) {return x + 5;}/int f5(int x) {return x + 6;}/' "$dir/a.c"
+    stats="$(./9cc --stats --cache="$dir/cache" "$dir/a.c" 2>&1 > "$dir/a.s" | grep '^cache:')"
+    if ! ./9cc "$dir/a.c" | cmp -s - "$dir/a.s" || [ "$stats" != "cache: 1000 hits, 1 misses" ]; then
+        echo "--cache => output differs or unexpected $stats"
+        exit 1
+    fi
+    echo "--cache => $stats"
+fi
+
+# --traceで段階ごとと関数ごとの区間をChrome trace形式で書き出す
+./9cc --trace="$dir/trace.json" "$dir/a.c" > /dev/null
+if ! grep -q '"name":"codegen","cat":"phase"' "$dir/trace.json" || ! grep -q '"name":"f999","cat":"function"' "$dir/trace.json"; then
+    echo "--trace => missing spans"
+    exit 1
+fi
+echo "--trace => $(grep -c '"ph":"X"' "$dir/trace.json") spans"
+
 echo OK
\ No newline at end of file
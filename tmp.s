@@ -0,0 +1,7994 @@
+.intel_syntax noprefix
+.globl dv
+dv:
+    push rbp
+    mov rbp, rsp
+    sub rsp, 40
+    push r12
+    mov [rbp-8], rdi
+    mov [rbp-16], rsi
+    lea r12, [rbp-16]
+    mov [rbp-24], r12
+    mov rax, [rbp-24]
+    mov r12, [rax]
+    mov rax, [rbp-8]
+    cqo
+    idiv r12
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.globl ml
+ml:
+    push rbp
+    mov rbp, rsp
+    sub rsp, 40
+    push r12
+    mov [rbp-8], rdi
+    mov [rbp-16], rsi
+    lea r12, [rbp-16]
+    mov [rbp-24], r12
+    mov rax, [rbp-24]
+    mov r12, [rax]
+    imul r12, [rbp-8]
+    mov rax, r12
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.globl t
+t:
+    push rbp
+    mov rbp, rsp
+    sub rsp, 32
+    push r12
+    push r13
+    mov [rbp-8], rdi
+    mov rax, -1054099661354831521
+    imul QWORD PTR [rbp-8]
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -70
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb2
+.Lt.bb1:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb2:
+    mov r12, [rbp-8]
+    imul r12, -70
+    mov rdi, [rbp-8]
+    mov rsi, -70
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb5
+.Lt.bb4:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb5:
+    mov r12, [rbp-8]
+    imul r12, -70
+    mov rdi, [rbp-8]
+    mov rsi, -70
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb8
+.Lt.bb7:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb8:
+    mov rax, -8555011744329067417
+    imul QWORD PTR [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -69
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb11
+.Lt.bb10:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb11:
+    mov r12, [rbp-8]
+    imul r12, -69
+    mov rdi, [rbp-8]
+    mov rsi, -69
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb14
+.Lt.bb13:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb14:
+    mov r12, [rbp-8]
+    imul r12, -69
+    mov rdi, [rbp-8]
+    mov rsi, -69
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb17
+.Lt.bb16:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb17:
+    mov rax, -8680820740569200761
+    imul QWORD PTR [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -68
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb20
+.Lt.bb19:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb20:
+    mov r12, [rbp-8]
+    imul r12, -68
+    mov rdi, [rbp-8]
+    mov rsi, -68
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb23
+.Lt.bb22:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb23:
+    mov r12, [rbp-8]
+    imul r12, -68
+    mov rdi, [rbp-8]
+    mov rsi, -68
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb26
+.Lt.bb25:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb26:
+    mov rax, -8810385229234412713
+    imul QWORD PTR [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -67
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb29
+.Lt.bb28:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb29:
+    mov r12, [rbp-8]
+    imul r12, -67
+    mov rdi, [rbp-8]
+    mov rsi, -67
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb32
+.Lt.bb31:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb32:
+    mov r12, [rbp-8]
+    imul r12, -67
+    mov rdi, [rbp-8]
+    mov rsi, -67
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb35
+.Lt.bb34:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb35:
+    mov rax, -1117984489315730401
+    imul QWORD PTR [rbp-8]
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -66
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb38
+.Lt.bb37:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb38:
+    mov r12, [rbp-8]
+    imul r12, -66
+    mov rdi, [rbp-8]
+    mov rsi, -66
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb41
+.Lt.bb40:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb41:
+    mov r12, [rbp-8]
+    imul r12, -66
+    mov rdi, [rbp-8]
+    mov rsi, -66
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb44
+.Lt.bb43:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb44:
+    mov rax, -1135184250689818561
+    imul QWORD PTR [rbp-8]
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -65
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb47
+.Lt.bb46:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb47:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 6
+    add r12, rdi
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -65
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb50
+.Lt.bb49:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb50:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 6
+    add r12, rdi
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -65
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb53
+.Lt.bb52:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb53:
+    mov rax, [rbp-8]
+    cqo
+    shr rdx, 58
+    add rax, rdx
+    sar rax, 6
+    neg rax
+    mov r12, rax
+    mov rdi, [rbp-8]
+    mov rsi, -64
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb56
+.Lt.bb55:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb56:
+    mov r12, [rbp-8]
+    shl r12, 6
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -64
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb59
+.Lt.bb58:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb59:
+    mov r12, [rbp-8]
+    shl r12, 6
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -64
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb62
+.Lt.bb61:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb62:
+    mov rax, 9076969306111049207
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -63
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb65
+.Lt.bb64:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb65:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 6
+    sub r12, rdi
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -63
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb68
+.Lt.bb67:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb68:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 6
+    sub r12, rdi
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -63
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb71
+.Lt.bb70:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb71:
+    mov rax, 8925843906633654007
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -62
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb74
+.Lt.bb73:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb74:
+    mov r12, [rbp-8]
+    imul r12, -62
+    mov rdi, [rbp-8]
+    mov rsi, -62
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb77
+.Lt.bb76:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb77:
+    mov r12, [rbp-8]
+    imul r12, -62
+    mov rdi, [rbp-8]
+    mov rsi, -62
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb80
+.Lt.bb79:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb80:
+    mov rax, 8769763576025852407
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -61
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb83
+.Lt.bb82:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb83:
+    mov r12, [rbp-8]
+    imul r12, -61
+    mov rdi, [rbp-8]
+    mov rsi, -61
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb86
+.Lt.bb85:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb86:
+    mov r12, [rbp-8]
+    imul r12, -61
+    mov rdi, [rbp-8]
+    mov rsi, -61
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb89
+.Lt.bb88:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb89:
+    mov rax, 8608480567731124087
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -60
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb92
+.Lt.bb91:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb92:
+    mov r12, [rbp-8]
+    imul r12, -60
+    mov rdi, [rbp-8]
+    mov rsi, -60
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb95
+.Lt.bb94:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb95:
+    mov r12, [rbp-8]
+    imul r12, -60
+    mov rdi, [rbp-8]
+    mov rsi, -60
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb98
+.Lt.bb97:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb98:
+    mov rax, 8441730338816235485
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -59
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb101
+.Lt.bb100:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb101:
+    mov r12, [rbp-8]
+    imul r12, -59
+    mov rdi, [rbp-8]
+    mov rsi, -59
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb104
+.Lt.bb103:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb104:
+    mov r12, [rbp-8]
+    imul r12, -59
+    mov rdi, [rbp-8]
+    mov rsi, -59
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb107
+.Lt.bb106:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb107:
+    mov rax, -5088756985850910791
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -58
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb110
+.Lt.bb109:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb110:
+    mov r12, [rbp-8]
+    imul r12, -58
+    mov rdi, [rbp-8]
+    mov rsi, -58
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb113
+.Lt.bb112:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb113:
+    mov r12, [rbp-8]
+    imul r12, -58
+    mov rdi, [rbp-8]
+    mov rsi, -58
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb116
+.Lt.bb115:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb116:
+    mov rax, 8090677225311206849
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -57
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb119
+.Lt.bb118:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb119:
+    mov r12, [rbp-8]
+    imul r12, -57
+    mov rdi, [rbp-8]
+    mov rsi, -57
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb122
+.Lt.bb121:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb122:
+    mov r12, [rbp-8]
+    imul r12, -57
+    mov rdi, [rbp-8]
+    mov rsi, -57
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb125
+.Lt.bb124:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb125:
+    mov rax, -5270498306774157605
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -56
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb128
+.Lt.bb127:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb128:
+    mov r12, [rbp-8]
+    imul r12, -56
+    mov rdi, [rbp-8]
+    mov rsi, -56
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb131
+.Lt.bb130:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb131:
+    mov r12, [rbp-8]
+    imul r12, -56
+    mov rdi, [rbp-8]
+    mov rsi, -56
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb134
+.Lt.bb133:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb134:
+    mov rax, -5366325548715505925
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -55
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb137
+.Lt.bb136:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb137:
+    mov r12, [rbp-8]
+    imul r12, -55
+    mov rdi, [rbp-8]
+    mov rsi, -55
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb140
+.Lt.bb139:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb140:
+    mov r12, [rbp-8]
+    imul r12, -55
+    mov rdi, [rbp-8]
+    mov rsi, -55
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb143
+.Lt.bb142:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb143:
+    mov rax, -341606371735362067
+    imul QWORD PTR [rbp-8]
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -54
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb146
+.Lt.bb145:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb146:
+    mov r12, [rbp-8]
+    imul r12, -54
+    mov rdi, [rbp-8]
+    mov rsi, -54
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb149
+.Lt.bb148:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb149:
+    mov r12, [rbp-8]
+    imul r12, -54
+    mov rdi, [rbp-8]
+    mov rsi, -54
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb152
+.Lt.bb151:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb152:
+    mov rax, -5568828399610430677
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -53
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb155
+.Lt.bb154:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb155:
+    mov r12, [rbp-8]
+    imul r12, -53
+    mov rdi, [rbp-8]
+    mov rsi, -53
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb158
+.Lt.bb157:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb158:
+    mov r12, [rbp-8]
+    imul r12, -53
+    mov rdi, [rbp-8]
+    mov rsi, -53
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb161
+.Lt.bb160:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb161:
+    mov rax, -5675921253449092805
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -52
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb164
+.Lt.bb163:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb164:
+    mov r12, [rbp-8]
+    imul r12, -52
+    mov rdi, [rbp-8]
+    mov rsi, -52
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb167
+.Lt.bb166:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb167:
+    mov r12, [rbp-8]
+    imul r12, -52
+    mov rdi, [rbp-8]
+    mov rsi, -52
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb170
+.Lt.bb169:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb170:
+    mov rax, 6872316419617283935
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -51
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb173
+.Lt.bb172:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb173:
+    mov r12, [rbp-8]
+    imul r12, -51
+    mov rdi, [rbp-8]
+    mov rsi, -51
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb176
+.Lt.bb175:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb176:
+    mov r12, [rbp-8]
+    imul r12, -51
+    mov rdi, [rbp-8]
+    mov rsi, -51
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb179
+.Lt.bb178:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb179:
+    mov rax, 6640827866535438581
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -50
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb182
+.Lt.bb181:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb182:
+    mov r12, [rbp-8]
+    imul r12, -50
+    mov rdi, [rbp-8]
+    mov rsi, -50
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb185
+.Lt.bb184:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb185:
+    mov r12, [rbp-8]
+    imul r12, -50
+    mov rdi, [rbp-8]
+    mov rsi, -50
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb188
+.Lt.bb187:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb188:
+    mov rax, -6023426636313322977
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -49
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb191
+.Lt.bb190:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb191:
+    mov r12, [rbp-8]
+    imul r12, -49
+    mov rdi, [rbp-8]
+    mov rsi, -49
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb194
+.Lt.bb193:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb194:
+    mov r12, [rbp-8]
+    imul r12, -49
+    mov rdi, [rbp-8]
+    mov rsi, -49
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb197
+.Lt.bb196:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb197:
+    mov rax, -3074457345618258603
+    imul QWORD PTR [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -48
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb200
+.Lt.bb199:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb200:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    shl r12, 4
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -48
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb203
+.Lt.bb202:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb203:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    shl r12, 4
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -48
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb206
+.Lt.bb205:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb206:
+    mov rax, -6279742663390485657
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -47
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb209
+.Lt.bb208:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb209:
+    mov r12, [rbp-8]
+    imul r12, -47
+    mov rdi, [rbp-8]
+    mov rsi, -47
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb212
+.Lt.bb211:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb212:
+    mov r12, [rbp-8]
+    imul r12, -47
+    mov rdi, [rbp-8]
+    mov rsi, -47
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb215
+.Lt.bb214:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb215:
+    mov rax, 5614226457215950491
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -46
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb218
+.Lt.bb217:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb218:
+    mov r12, [rbp-8]
+    imul r12, -46
+    mov rdi, [rbp-8]
+    mov rsi, -46
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb221
+.Lt.bb220:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb221:
+    mov r12, [rbp-8]
+    imul r12, -46
+    mov rdi, [rbp-8]
+    mov rsi, -46
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb224
+.Lt.bb223:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb224:
+    mov rax, -3279421168659475843
+    imul QWORD PTR [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -45
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb227
+.Lt.bb226:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb227:
+    mov r12, [rbp-8]
+    imul r12, -45
+    mov rdi, [rbp-8]
+    mov rsi, -45
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb230
+.Lt.bb229:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb230:
+    mov r12, [rbp-8]
+    imul r12, -45
+    mov rdi, [rbp-8]
+    mov rsi, -45
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb233
+.Lt.bb232:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb233:
+    mov rax, -3353953467947191203
+    imul QWORD PTR [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -44
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb236
+.Lt.bb235:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb236:
+    mov r12, [rbp-8]
+    imul r12, -44
+    mov rdi, [rbp-8]
+    mov rsi, -44
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb239
+.Lt.bb238:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb239:
+    mov r12, [rbp-8]
+    imul r12, -44
+    mov rdi, [rbp-8]
+    mov rsi, -44
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb242
+.Lt.bb241:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb242:
+    mov rax, 4718934530483838785
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -43
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb245
+.Lt.bb244:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb245:
+    mov r12, [rbp-8]
+    imul r12, -43
+    mov rdi, [rbp-8]
+    mov rsi, -43
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb248
+.Lt.bb247:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb248:
+    mov r12, [rbp-8]
+    imul r12, -43
+    mov rdi, [rbp-8]
+    mov rsi, -43
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb251
+.Lt.bb250:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb251:
+    mov rax, 4392081922311798003
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -42
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb254
+.Lt.bb253:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb254:
+    mov r12, [rbp-8]
+    imul r12, -42
+    mov rdi, [rbp-8]
+    mov rsi, -42
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb257
+.Lt.bb256:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb257:
+    mov r12, [rbp-8]
+    imul r12, -42
+    mov rdi, [rbp-8]
+    mov rsi, -42
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb260
+.Lt.bb259:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb260:
+    mov rax, -7198729394618361607
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -41
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb263
+.Lt.bb262:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb263:
+    mov r12, [rbp-8]
+    imul r12, -41
+    mov rdi, [rbp-8]
+    mov rsi, -41
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb266
+.Lt.bb265:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb266:
+    mov r12, [rbp-8]
+    imul r12, -41
+    mov rdi, [rbp-8]
+    mov rsi, -41
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb269
+.Lt.bb268:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb269:
+    mov rax, -7378697629483820647
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -40
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb272
+.Lt.bb271:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb272:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*4]
+    shl r12, 3
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -40
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb275
+.Lt.bb274:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb275:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*4]
+    shl r12, 3
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -40
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb278
+.Lt.bb277:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb278:
+    mov rax, -7567895004598790407
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -39
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb281
+.Lt.bb280:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb281:
+    mov r12, [rbp-8]
+    imul r12, -39
+    mov rdi, [rbp-8]
+    mov rsi, -39
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb284
+.Lt.bb283:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb284:
+    mov r12, [rbp-8]
+    imul r12, -39
+    mov rdi, [rbp-8]
+    mov rsi, -39
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb287
+.Lt.bb286:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb287:
+    mov rax, -485440633518672411
+    imul QWORD PTR [rbp-8]
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -38
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb290
+.Lt.bb289:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb290:
+    mov r12, [rbp-8]
+    imul r12, -38
+    mov rdi, [rbp-8]
+    mov rsi, -38
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb293
+.Lt.bb292:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb293:
+    mov r12, [rbp-8]
+    imul r12, -38
+    mov rdi, [rbp-8]
+    mov rsi, -38
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb296
+.Lt.bb295:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb296:
+    mov rax, -3988485205126389539
+    imul QWORD PTR [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -37
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb299
+.Lt.bb298:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb299:
+    mov r12, [rbp-8]
+    imul r12, -37
+    mov rdi, [rbp-8]
+    mov rsi, -37
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb302
+.Lt.bb301:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb302:
+    mov r12, [rbp-8]
+    imul r12, -37
+    mov rdi, [rbp-8]
+    mov rsi, -37
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb305
+.Lt.bb304:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb305:
+    mov rax, -1024819115206086201
+    imul QWORD PTR [rbp-8]
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -36
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb308
+.Lt.bb307:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb308:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*8]
+    shl r12, 2
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -36
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb311
+.Lt.bb310:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb311:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*8]
+    shl r12, 2
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -36
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb314
+.Lt.bb313:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb314:
+    mov rax, -1054099661354831521
+    imul QWORD PTR [rbp-8]
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -35
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb317
+.Lt.bb316:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb317:
+    mov r12, [rbp-8]
+    imul r12, -35
+    mov rdi, [rbp-8]
+    mov rsi, -35
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb320
+.Lt.bb319:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb320:
+    mov r12, [rbp-8]
+    imul r12, -35
+    mov rdi, [rbp-8]
+    mov rsi, -35
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb323
+.Lt.bb322:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb323:
+    mov rax, -8680820740569200761
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -34
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb326
+.Lt.bb325:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb326:
+    mov r12, [rbp-8]
+    imul r12, -34
+    mov rdi, [rbp-8]
+    mov rsi, -34
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb329
+.Lt.bb328:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb329:
+    mov r12, [rbp-8]
+    imul r12, -34
+    mov rdi, [rbp-8]
+    mov rsi, -34
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb332
+.Lt.bb331:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb332:
+    mov rax, -1117984489315730401
+    imul QWORD PTR [rbp-8]
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -33
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb335
+.Lt.bb334:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb335:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 5
+    add r12, rdi
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -33
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb338
+.Lt.bb337:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb338:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 5
+    add r12, rdi
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -33
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb341
+.Lt.bb340:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb341:
+    mov rax, [rbp-8]
+    cqo
+    shr rdx, 59
+    add rax, rdx
+    sar rax, 5
+    neg rax
+    mov r12, rax
+    mov rdi, [rbp-8]
+    mov rsi, -32
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb344
+.Lt.bb343:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb344:
+    mov r12, [rbp-8]
+    shl r12, 5
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -32
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb347
+.Lt.bb346:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb347:
+    mov r12, [rbp-8]
+    shl r12, 5
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -32
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb350
+.Lt.bb349:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb350:
+    mov rax, 8925843906633654007
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -31
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb353
+.Lt.bb352:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb353:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 5
+    sub r12, rdi
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -31
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb356
+.Lt.bb355:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb356:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 5
+    sub r12, rdi
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -31
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb359
+.Lt.bb358:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb359:
+    mov rax, 8608480567731124087
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -30
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb362
+.Lt.bb361:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb362:
+    mov r12, [rbp-8]
+    imul r12, -30
+    mov rdi, [rbp-8]
+    mov rsi, -30
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb365
+.Lt.bb364:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb365:
+    mov r12, [rbp-8]
+    imul r12, -30
+    mov rdi, [rbp-8]
+    mov rsi, -30
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb368
+.Lt.bb367:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb368:
+    mov rax, -5088756985850910791
+    imul QWORD PTR [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -29
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb371
+.Lt.bb370:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb371:
+    mov r12, [rbp-8]
+    imul r12, -29
+    mov rdi, [rbp-8]
+    mov rsi, -29
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb374
+.Lt.bb373:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb374:
+    mov r12, [rbp-8]
+    imul r12, -29
+    mov rdi, [rbp-8]
+    mov rsi, -29
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb377
+.Lt.bb376:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb377:
+    mov rax, -5270498306774157605
+    imul QWORD PTR [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -28
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb380
+.Lt.bb379:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb380:
+    mov r12, [rbp-8]
+    imul r12, -28
+    mov rdi, [rbp-8]
+    mov rsi, -28
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb383
+.Lt.bb382:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb383:
+    mov r12, [rbp-8]
+    imul r12, -28
+    mov rdi, [rbp-8]
+    mov rsi, -28
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb386
+.Lt.bb385:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb386:
+    mov rax, 7515340178177965473
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -27
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb389
+.Lt.bb388:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb389:
+    mov r12, [rbp-8]
+    imul r12, -27
+    mov rdi, [rbp-8]
+    mov rsi, -27
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb392
+.Lt.bb391:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb392:
+    mov r12, [rbp-8]
+    imul r12, -27
+    mov rdi, [rbp-8]
+    mov rsi, -27
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb395
+.Lt.bb394:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb395:
+    mov rax, -5675921253449092805
+    imul QWORD PTR [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -26
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb398
+.Lt.bb397:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb398:
+    mov r12, [rbp-8]
+    imul r12, -26
+    mov rdi, [rbp-8]
+    mov rsi, -26
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb401
+.Lt.bb400:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb401:
+    mov r12, [rbp-8]
+    imul r12, -26
+    mov rdi, [rbp-8]
+    mov rsi, -26
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb404
+.Lt.bb403:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb404:
+    mov rax, 6640827866535438581
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -25
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb407
+.Lt.bb406:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb407:
+    mov r12, [rbp-8]
+    imul r12, -25
+    mov rdi, [rbp-8]
+    mov rsi, -25
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb410
+.Lt.bb409:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb410:
+    mov r12, [rbp-8]
+    imul r12, -25
+    mov rdi, [rbp-8]
+    mov rsi, -25
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb413
+.Lt.bb412:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb413:
+    mov rax, -3074457345618258603
+    imul QWORD PTR [rbp-8]
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -24
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb416
+.Lt.bb415:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb416:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    shl r12, 3
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -24
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb419
+.Lt.bb418:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb419:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    shl r12, 3
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -24
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb422
+.Lt.bb421:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb422:
+    mov rax, 5614226457215950491
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -23
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb425
+.Lt.bb424:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb425:
+    mov r12, [rbp-8]
+    imul r12, -23
+    mov rdi, [rbp-8]
+    mov rsi, -23
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb428
+.Lt.bb427:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb428:
+    mov r12, [rbp-8]
+    imul r12, -23
+    mov rdi, [rbp-8]
+    mov rsi, -23
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb431
+.Lt.bb430:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb431:
+    mov rax, -3353953467947191203
+    imul QWORD PTR [rbp-8]
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -22
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb434
+.Lt.bb433:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb434:
+    mov r12, [rbp-8]
+    imul r12, -22
+    mov rdi, [rbp-8]
+    mov rsi, -22
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb437
+.Lt.bb436:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb437:
+    mov r12, [rbp-8]
+    imul r12, -22
+    mov rdi, [rbp-8]
+    mov rsi, -22
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb440
+.Lt.bb439:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb440:
+    mov rax, 4392081922311798003
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -21
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb443
+.Lt.bb442:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb443:
+    mov r12, [rbp-8]
+    imul r12, -21
+    mov rdi, [rbp-8]
+    mov rsi, -21
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb446
+.Lt.bb445:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb446:
+    mov r12, [rbp-8]
+    imul r12, -21
+    mov rdi, [rbp-8]
+    mov rsi, -21
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb449
+.Lt.bb448:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb449:
+    mov rax, -7378697629483820647
+    imul QWORD PTR [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -20
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb452
+.Lt.bb451:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb452:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*4]
+    shl r12, 2
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -20
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb455
+.Lt.bb454:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb455:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*4]
+    shl r12, 2
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -20
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb458
+.Lt.bb457:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb458:
+    mov rax, 2912643801112034465
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -19
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb461
+.Lt.bb460:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb461:
+    mov r12, [rbp-8]
+    imul r12, -19
+    mov rdi, [rbp-8]
+    mov rsi, -19
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb464
+.Lt.bb463:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb464:
+    mov r12, [rbp-8]
+    imul r12, -19
+    mov rdi, [rbp-8]
+    mov rsi, -19
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb467
+.Lt.bb466:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb467:
+    mov rax, -1024819115206086201
+    imul QWORD PTR [rbp-8]
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -18
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb470
+.Lt.bb469:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb470:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*8]
+    shl r12, 1
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -18
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb473
+.Lt.bb472:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb473:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*8]
+    shl r12, 1
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -18
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb476
+.Lt.bb475:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb476:
+    mov rax, -8680820740569200761
+    imul QWORD PTR [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -17
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb479
+.Lt.bb478:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb479:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 4
+    add r12, rdi
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -17
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb482
+.Lt.bb481:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb482:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 4
+    add r12, rdi
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -17
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb485
+.Lt.bb484:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb485:
+    mov rax, [rbp-8]
+    cqo
+    shr rdx, 60
+    add rax, rdx
+    sar rax, 4
+    neg rax
+    mov r12, rax
+    mov rdi, [rbp-8]
+    mov rsi, -16
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb488
+.Lt.bb487:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb488:
+    mov r12, [rbp-8]
+    shl r12, 4
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -16
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb491
+.Lt.bb490:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb491:
+    mov r12, [rbp-8]
+    shl r12, 4
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -16
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb494
+.Lt.bb493:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb494:
+    mov rax, 8608480567731124087
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -15
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb497
+.Lt.bb496:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb497:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 4
+    sub r12, rdi
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -15
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb500
+.Lt.bb499:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb500:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 4
+    sub r12, rdi
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -15
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb503
+.Lt.bb502:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb503:
+    mov rax, -5270498306774157605
+    imul QWORD PTR [rbp-8]
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -14
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb506
+.Lt.bb505:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb506:
+    mov r12, [rbp-8]
+    imul r12, -14
+    mov rdi, [rbp-8]
+    mov rsi, -14
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb509
+.Lt.bb508:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb509:
+    mov r12, [rbp-8]
+    imul r12, -14
+    mov rdi, [rbp-8]
+    mov rsi, -14
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb512
+.Lt.bb511:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb512:
+    mov rax, -5675921253449092805
+    imul QWORD PTR [rbp-8]
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -13
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb515
+.Lt.bb514:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb515:
+    mov r12, [rbp-8]
+    imul r12, -13
+    mov rdi, [rbp-8]
+    mov rsi, -13
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb518
+.Lt.bb517:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb518:
+    mov r12, [rbp-8]
+    imul r12, -13
+    mov rdi, [rbp-8]
+    mov rsi, -13
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb521
+.Lt.bb520:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb521:
+    mov rax, -3074457345618258603
+    imul QWORD PTR [rbp-8]
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -12
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb524
+.Lt.bb523:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb524:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    shl r12, 2
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -12
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb527
+.Lt.bb526:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb527:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    shl r12, 2
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -12
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb530
+.Lt.bb529:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb530:
+    mov rax, -3353953467947191203
+    imul QWORD PTR [rbp-8]
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -11
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb533
+.Lt.bb532:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb533:
+    mov r12, [rbp-8]
+    imul r12, -11
+    mov rdi, [rbp-8]
+    mov rsi, -11
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb536
+.Lt.bb535:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb536:
+    mov r12, [rbp-8]
+    imul r12, -11
+    mov rdi, [rbp-8]
+    mov rsi, -11
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb539
+.Lt.bb538:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb539:
+    mov rax, -7378697629483820647
+    imul QWORD PTR [rbp-8]
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -10
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb542
+.Lt.bb541:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb542:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*4]
+    shl r12, 1
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -10
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb545
+.Lt.bb544:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb545:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*4]
+    shl r12, 1
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -10
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb548
+.Lt.bb547:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb548:
+    mov rax, 2049638230412172401
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -9
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb551
+.Lt.bb550:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb551:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*8]
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -9
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb554
+.Lt.bb553:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb554:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*8]
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -9
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb557
+.Lt.bb556:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb557:
+    mov rax, [rbp-8]
+    cqo
+    shr rdx, 61
+    add rax, rdx
+    sar rax, 3
+    neg rax
+    mov r12, rax
+    mov rdi, [rbp-8]
+    mov rsi, -8
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb560
+.Lt.bb559:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb560:
+    mov r12, [rbp-8]
+    shl r12, 3
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -8
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb563
+.Lt.bb562:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb563:
+    mov r12, [rbp-8]
+    shl r12, 3
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -8
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb566
+.Lt.bb565:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb566:
+    mov rax, -5270498306774157605
+    imul QWORD PTR [rbp-8]
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -7
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb569
+.Lt.bb568:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb569:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 3
+    sub r12, rdi
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -7
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb572
+.Lt.bb571:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb572:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 3
+    sub r12, rdi
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -7
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb575
+.Lt.bb574:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb575:
+    mov rax, -3074457345618258603
+    imul QWORD PTR [rbp-8]
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -6
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb578
+.Lt.bb577:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb578:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    shl r12, 1
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -6
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb581
+.Lt.bb580:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb581:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    shl r12, 1
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -6
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb584
+.Lt.bb583:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb584:
+    mov rax, -7378697629483820647
+    imul QWORD PTR [rbp-8]
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -5
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb587
+.Lt.bb586:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb587:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*4]
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -5
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb590
+.Lt.bb589:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb590:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*4]
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -5
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb593
+.Lt.bb592:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb593:
+    mov rax, [rbp-8]
+    cqo
+    shr rdx, 62
+    add rax, rdx
+    sar rax, 2
+    neg rax
+    mov r12, rax
+    mov rdi, [rbp-8]
+    mov rsi, -4
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb596
+.Lt.bb595:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb596:
+    mov r12, [rbp-8]
+    shl r12, 2
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -4
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb599
+.Lt.bb598:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb599:
+    mov r12, [rbp-8]
+    shl r12, 2
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -4
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb602
+.Lt.bb601:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb602:
+    mov rax, 6148914691236517205
+    imul QWORD PTR [rbp-8]
+    sub rdx, [rbp-8]
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, -3
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb605
+.Lt.bb604:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb605:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -3
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb608
+.Lt.bb607:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb608:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -3
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb611
+.Lt.bb610:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb611:
+    mov rax, [rbp-8]
+    cqo
+    shr rdx, 63
+    add rax, rdx
+    sar rax, 1
+    neg rax
+    mov r12, rax
+    mov rdi, [rbp-8]
+    mov rsi, -2
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb614
+.Lt.bb613:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb614:
+    mov r12, [rbp-8]
+    shl r12, 1
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -2
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb617
+.Lt.bb616:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb617:
+    mov r12, [rbp-8]
+    shl r12, 1
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -2
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb620
+.Lt.bb619:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb620:
+    mov rax, [rbp-8]
+    neg rax
+    mov r12, rax
+    mov rdi, [rbp-8]
+    mov rsi, -1
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb623
+.Lt.bb622:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb623:
+    mov r12, [rbp-8]
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -1
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb626
+.Lt.bb625:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb626:
+    mov r12, [rbp-8]
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -1
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb629
+.Lt.bb628:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb629:
+    mov rdi, [rbp-8]
+    mov rsi, 1
+    call dv
+    mov r12, rax
+    cmp [rbp-8], r12
+    je .Lt.bb632
+.Lt.bb631:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb632:
+    mov rdi, [rbp-8]
+    mov rsi, 1
+    call ml
+    mov r12, rax
+    cmp [rbp-8], r12
+    je .Lt.bb635
+.Lt.bb634:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb635:
+    mov rdi, [rbp-8]
+    mov rsi, 1
+    call ml
+    mov r12, rax
+    cmp [rbp-8], r12
+    je .Lt.bb638
+.Lt.bb637:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb638:
+    mov rax, [rbp-8]
+    cqo
+    shr rdx, 63
+    add rax, rdx
+    sar rax, 1
+    mov r12, rax
+    mov rdi, [rbp-8]
+    mov rsi, 2
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb641
+.Lt.bb640:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb641:
+    mov r12, [rbp-8]
+    shl r12, 1
+    mov rdi, [rbp-8]
+    mov rsi, 2
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb644
+.Lt.bb643:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb644:
+    mov r12, [rbp-8]
+    shl r12, 1
+    mov rdi, [rbp-8]
+    mov rsi, 2
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb647
+.Lt.bb646:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb647:
+    mov rax, 6148914691236517206
+    imul QWORD PTR [rbp-8]
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 3
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb650
+.Lt.bb649:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb650:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    mov rdi, [rbp-8]
+    mov rsi, 3
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb653
+.Lt.bb652:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb653:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    mov rdi, [rbp-8]
+    mov rsi, 3
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb656
+.Lt.bb655:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb656:
+    mov rax, [rbp-8]
+    cqo
+    shr rdx, 62
+    add rax, rdx
+    sar rax, 2
+    mov r12, rax
+    mov rdi, [rbp-8]
+    mov rsi, 4
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb659
+.Lt.bb658:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb659:
+    mov r12, [rbp-8]
+    shl r12, 2
+    mov rdi, [rbp-8]
+    mov rsi, 4
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb662
+.Lt.bb661:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb662:
+    mov r12, [rbp-8]
+    shl r12, 2
+    mov rdi, [rbp-8]
+    mov rsi, 4
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb665
+.Lt.bb664:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb665:
+    mov rax, 7378697629483820647
+    imul QWORD PTR [rbp-8]
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 5
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb668
+.Lt.bb667:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb668:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*4]
+    mov rdi, [rbp-8]
+    mov rsi, 5
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb671
+.Lt.bb670:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb671:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*4]
+    mov rdi, [rbp-8]
+    mov rsi, 5
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb674
+.Lt.bb673:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb674:
+    mov rax, 3074457345618258603
+    imul QWORD PTR [rbp-8]
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 6
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb677
+.Lt.bb676:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb677:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    shl r12, 1
+    mov rdi, [rbp-8]
+    mov rsi, 6
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb680
+.Lt.bb679:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb680:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    shl r12, 1
+    mov rdi, [rbp-8]
+    mov rsi, 6
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb683
+.Lt.bb682:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb683:
+    mov rax, 5270498306774157605
+    imul QWORD PTR [rbp-8]
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 7
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb686
+.Lt.bb685:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb686:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 3
+    sub r12, rdi
+    mov rdi, [rbp-8]
+    mov rsi, 7
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb689
+.Lt.bb688:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb689:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 3
+    sub r12, rdi
+    mov rdi, [rbp-8]
+    mov rsi, 7
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb692
+.Lt.bb691:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb692:
+    mov rax, [rbp-8]
+    cqo
+    shr rdx, 61
+    add rax, rdx
+    sar rax, 3
+    mov r12, rax
+    mov rdi, [rbp-8]
+    mov rsi, 8
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb695
+.Lt.bb694:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb695:
+    mov r12, [rbp-8]
+    shl r12, 3
+    mov rdi, [rbp-8]
+    mov rsi, 8
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb698
+.Lt.bb697:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb698:
+    mov r12, [rbp-8]
+    shl r12, 3
+    mov rdi, [rbp-8]
+    mov rsi, 8
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb701
+.Lt.bb700:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb701:
+    mov rax, 2049638230412172402
+    imul QWORD PTR [rbp-8]
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 9
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb704
+.Lt.bb703:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb704:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*8]
+    mov rdi, [rbp-8]
+    mov rsi, 9
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb707
+.Lt.bb706:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb707:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*8]
+    mov rdi, [rbp-8]
+    mov rsi, 9
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb710
+.Lt.bb709:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb710:
+    mov rax, 7378697629483820647
+    imul QWORD PTR [rbp-8]
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 10
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb713
+.Lt.bb712:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb713:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*4]
+    shl r12, 1
+    mov rdi, [rbp-8]
+    mov rsi, 10
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb716
+.Lt.bb715:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb716:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*4]
+    shl r12, 1
+    mov rdi, [rbp-8]
+    mov rsi, 10
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb719
+.Lt.bb718:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb719:
+    mov rax, 3353953467947191203
+    imul QWORD PTR [rbp-8]
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 11
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb722
+.Lt.bb721:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb722:
+    mov r12, [rbp-8]
+    imul r12, 11
+    mov rdi, [rbp-8]
+    mov rsi, 11
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb725
+.Lt.bb724:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb725:
+    mov r12, [rbp-8]
+    imul r12, 11
+    mov rdi, [rbp-8]
+    mov rsi, 11
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb728
+.Lt.bb727:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb728:
+    mov rax, 3074457345618258603
+    imul QWORD PTR [rbp-8]
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 12
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb731
+.Lt.bb730:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb731:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    shl r12, 2
+    mov rdi, [rbp-8]
+    mov rsi, 12
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb734
+.Lt.bb733:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb734:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    shl r12, 2
+    mov rdi, [rbp-8]
+    mov rsi, 12
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb737
+.Lt.bb736:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb737:
+    mov rax, 5675921253449092805
+    imul QWORD PTR [rbp-8]
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 13
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb740
+.Lt.bb739:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb740:
+    mov r12, [rbp-8]
+    imul r12, 13
+    mov rdi, [rbp-8]
+    mov rsi, 13
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb743
+.Lt.bb742:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb743:
+    mov r12, [rbp-8]
+    imul r12, 13
+    mov rdi, [rbp-8]
+    mov rsi, 13
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb746
+.Lt.bb745:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb746:
+    mov rax, 5270498306774157605
+    imul QWORD PTR [rbp-8]
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 14
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb749
+.Lt.bb748:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb749:
+    mov r12, [rbp-8]
+    imul r12, 14
+    mov rdi, [rbp-8]
+    mov rsi, 14
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb752
+.Lt.bb751:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb752:
+    mov r12, [rbp-8]
+    imul r12, 14
+    mov rdi, [rbp-8]
+    mov rsi, 14
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb755
+.Lt.bb754:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb755:
+    mov rax, -8608480567731124087
+    imul QWORD PTR [rbp-8]
+    add rdx, [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 15
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb758
+.Lt.bb757:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb758:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 4
+    sub r12, rdi
+    mov rdi, [rbp-8]
+    mov rsi, 15
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb761
+.Lt.bb760:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb761:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 4
+    sub r12, rdi
+    mov rdi, [rbp-8]
+    mov rsi, 15
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb764
+.Lt.bb763:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb764:
+    mov rax, [rbp-8]
+    cqo
+    shr rdx, 60
+    add rax, rdx
+    sar rax, 4
+    mov r12, rax
+    mov rdi, [rbp-8]
+    mov rsi, 16
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb767
+.Lt.bb766:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb767:
+    mov r12, [rbp-8]
+    shl r12, 4
+    mov rdi, [rbp-8]
+    mov rsi, 16
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb770
+.Lt.bb769:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb770:
+    mov r12, [rbp-8]
+    shl r12, 4
+    mov rdi, [rbp-8]
+    mov rsi, 16
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb773
+.Lt.bb772:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb773:
+    mov rax, 8680820740569200761
+    imul QWORD PTR [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 17
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb776
+.Lt.bb775:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb776:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 4
+    add r12, rdi
+    mov rdi, [rbp-8]
+    mov rsi, 17
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb779
+.Lt.bb778:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb779:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 4
+    add r12, rdi
+    mov rdi, [rbp-8]
+    mov rsi, 17
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb782
+.Lt.bb781:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb782:
+    mov rax, 1024819115206086201
+    imul QWORD PTR [rbp-8]
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 18
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb785
+.Lt.bb784:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb785:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*8]
+    shl r12, 1
+    mov rdi, [rbp-8]
+    mov rsi, 18
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb788
+.Lt.bb787:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb788:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*8]
+    shl r12, 1
+    mov rdi, [rbp-8]
+    mov rsi, 18
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb791
+.Lt.bb790:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb791:
+    mov rax, 970881267037344822
+    imul QWORD PTR [rbp-8]
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 19
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb794
+.Lt.bb793:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb794:
+    mov r12, [rbp-8]
+    imul r12, 19
+    mov rdi, [rbp-8]
+    mov rsi, 19
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb797
+.Lt.bb796:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb797:
+    mov r12, [rbp-8]
+    imul r12, 19
+    mov rdi, [rbp-8]
+    mov rsi, 19
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb800
+.Lt.bb799:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb800:
+    mov rax, 7378697629483820647
+    imul QWORD PTR [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 20
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb803
+.Lt.bb802:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb803:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*4]
+    shl r12, 2
+    mov rdi, [rbp-8]
+    mov rsi, 20
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb806
+.Lt.bb805:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb806:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*4]
+    shl r12, 2
+    mov rdi, [rbp-8]
+    mov rsi, 20
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb809
+.Lt.bb808:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb809:
+    mov rax, -4392081922311798003
+    imul QWORD PTR [rbp-8]
+    add rdx, [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 21
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb812
+.Lt.bb811:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb812:
+    mov r12, [rbp-8]
+    imul r12, 21
+    mov rdi, [rbp-8]
+    mov rsi, 21
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb815
+.Lt.bb814:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb815:
+    mov r12, [rbp-8]
+    imul r12, 21
+    mov rdi, [rbp-8]
+    mov rsi, 21
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb818
+.Lt.bb817:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb818:
+    mov rax, 3353953467947191203
+    imul QWORD PTR [rbp-8]
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 22
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb821
+.Lt.bb820:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb821:
+    mov r12, [rbp-8]
+    imul r12, 22
+    mov rdi, [rbp-8]
+    mov rsi, 22
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb824
+.Lt.bb823:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb824:
+    mov r12, [rbp-8]
+    imul r12, 22
+    mov rdi, [rbp-8]
+    mov rsi, 22
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb827
+.Lt.bb826:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb827:
+    mov rax, -5614226457215950491
+    imul QWORD PTR [rbp-8]
+    add rdx, [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 23
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb830
+.Lt.bb829:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb830:
+    mov r12, [rbp-8]
+    imul r12, 23
+    mov rdi, [rbp-8]
+    mov rsi, 23
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb833
+.Lt.bb832:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb833:
+    mov r12, [rbp-8]
+    imul r12, 23
+    mov rdi, [rbp-8]
+    mov rsi, 23
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb836
+.Lt.bb835:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb836:
+    mov rax, 3074457345618258603
+    imul QWORD PTR [rbp-8]
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 24
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb839
+.Lt.bb838:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb839:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    shl r12, 3
+    mov rdi, [rbp-8]
+    mov rsi, 24
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb842
+.Lt.bb841:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb842:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    shl r12, 3
+    mov rdi, [rbp-8]
+    mov rsi, 24
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb845
+.Lt.bb844:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb845:
+    mov rax, -6640827866535438581
+    imul QWORD PTR [rbp-8]
+    add rdx, [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 25
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb848
+.Lt.bb847:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb848:
+    mov r12, [rbp-8]
+    imul r12, 25
+    mov rdi, [rbp-8]
+    mov rsi, 25
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb851
+.Lt.bb850:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb851:
+    mov r12, [rbp-8]
+    imul r12, 25
+    mov rdi, [rbp-8]
+    mov rsi, 25
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb854
+.Lt.bb853:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb854:
+    mov rax, 5675921253449092805
+    imul QWORD PTR [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 26
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb857
+.Lt.bb856:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb857:
+    mov r12, [rbp-8]
+    imul r12, 26
+    mov rdi, [rbp-8]
+    mov rsi, 26
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb860
+.Lt.bb859:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb860:
+    mov r12, [rbp-8]
+    imul r12, 26
+    mov rdi, [rbp-8]
+    mov rsi, 26
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb863
+.Lt.bb862:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb863:
+    mov rax, 683212743470724134
+    imul QWORD PTR [rbp-8]
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 27
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb866
+.Lt.bb865:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb866:
+    mov r12, [rbp-8]
+    imul r12, 27
+    mov rdi, [rbp-8]
+    mov rsi, 27
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb869
+.Lt.bb868:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb869:
+    mov r12, [rbp-8]
+    imul r12, 27
+    mov rdi, [rbp-8]
+    mov rsi, 27
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb872
+.Lt.bb871:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb872:
+    mov rax, 5270498306774157605
+    imul QWORD PTR [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 28
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb875
+.Lt.bb874:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb875:
+    mov r12, [rbp-8]
+    imul r12, 28
+    mov rdi, [rbp-8]
+    mov rsi, 28
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb878
+.Lt.bb877:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb878:
+    mov r12, [rbp-8]
+    imul r12, 28
+    mov rdi, [rbp-8]
+    mov rsi, 28
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb881
+.Lt.bb880:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb881:
+    mov rax, 5088756985850910791
+    imul QWORD PTR [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 29
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb884
+.Lt.bb883:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb884:
+    mov r12, [rbp-8]
+    imul r12, 29
+    mov rdi, [rbp-8]
+    mov rsi, 29
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb887
+.Lt.bb886:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb887:
+    mov r12, [rbp-8]
+    imul r12, 29
+    mov rdi, [rbp-8]
+    mov rsi, 29
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb890
+.Lt.bb889:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb890:
+    mov rax, -8608480567731124087
+    imul QWORD PTR [rbp-8]
+    add rdx, [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 30
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb893
+.Lt.bb892:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb893:
+    mov r12, [rbp-8]
+    imul r12, 30
+    mov rdi, [rbp-8]
+    mov rsi, 30
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb896
+.Lt.bb895:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb896:
+    mov r12, [rbp-8]
+    imul r12, 30
+    mov rdi, [rbp-8]
+    mov rsi, 30
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb899
+.Lt.bb898:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb899:
+    mov rax, -8925843906633654007
+    imul QWORD PTR [rbp-8]
+    add rdx, [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 31
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb902
+.Lt.bb901:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb902:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 5
+    sub r12, rdi
+    mov rdi, [rbp-8]
+    mov rsi, 31
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb905
+.Lt.bb904:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb905:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 5
+    sub r12, rdi
+    mov rdi, [rbp-8]
+    mov rsi, 31
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb908
+.Lt.bb907:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb908:
+    mov rax, [rbp-8]
+    cqo
+    shr rdx, 59
+    add rax, rdx
+    sar rax, 5
+    mov r12, rax
+    mov rdi, [rbp-8]
+    mov rsi, 32
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb911
+.Lt.bb910:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb911:
+    mov r12, [rbp-8]
+    shl r12, 5
+    mov rdi, [rbp-8]
+    mov rsi, 32
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb914
+.Lt.bb913:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb914:
+    mov r12, [rbp-8]
+    shl r12, 5
+    mov rdi, [rbp-8]
+    mov rsi, 32
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb917
+.Lt.bb916:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb917:
+    mov rax, 1117984489315730401
+    imul QWORD PTR [rbp-8]
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 33
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb920
+.Lt.bb919:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb920:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 5
+    add r12, rdi
+    mov rdi, [rbp-8]
+    mov rsi, 33
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb923
+.Lt.bb922:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb923:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 5
+    add r12, rdi
+    mov rdi, [rbp-8]
+    mov rsi, 33
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb926
+.Lt.bb925:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb926:
+    mov rax, 8680820740569200761
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 34
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb929
+.Lt.bb928:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb929:
+    mov r12, [rbp-8]
+    imul r12, 34
+    mov rdi, [rbp-8]
+    mov rsi, 34
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb932
+.Lt.bb931:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb932:
+    mov r12, [rbp-8]
+    imul r12, 34
+    mov rdi, [rbp-8]
+    mov rsi, 34
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb935
+.Lt.bb934:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb935:
+    mov rax, 1054099661354831521
+    imul QWORD PTR [rbp-8]
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 35
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb938
+.Lt.bb937:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb938:
+    mov r12, [rbp-8]
+    imul r12, 35
+    mov rdi, [rbp-8]
+    mov rsi, 35
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb941
+.Lt.bb940:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb941:
+    mov r12, [rbp-8]
+    imul r12, 35
+    mov rdi, [rbp-8]
+    mov rsi, 35
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb944
+.Lt.bb943:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb944:
+    mov rax, 1024819115206086201
+    imul QWORD PTR [rbp-8]
+    sar rdx, 1
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 36
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb947
+.Lt.bb946:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb947:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*8]
+    shl r12, 2
+    mov rdi, [rbp-8]
+    mov rsi, 36
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb950
+.Lt.bb949:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb950:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*8]
+    shl r12, 2
+    mov rdi, [rbp-8]
+    mov rsi, 36
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb953
+.Lt.bb952:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb953:
+    mov rax, 3988485205126389539
+    imul QWORD PTR [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 37
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb956
+.Lt.bb955:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb956:
+    mov r12, [rbp-8]
+    imul r12, 37
+    mov rdi, [rbp-8]
+    mov rsi, 37
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb959
+.Lt.bb958:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb959:
+    mov r12, [rbp-8]
+    imul r12, 37
+    mov rdi, [rbp-8]
+    mov rsi, 37
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb962
+.Lt.bb961:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb962:
+    mov rax, 485440633518672411
+    imul QWORD PTR [rbp-8]
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 38
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb965
+.Lt.bb964:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb965:
+    mov r12, [rbp-8]
+    imul r12, 38
+    mov rdi, [rbp-8]
+    mov rsi, 38
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb968
+.Lt.bb967:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb968:
+    mov r12, [rbp-8]
+    imul r12, 38
+    mov rdi, [rbp-8]
+    mov rsi, 38
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb971
+.Lt.bb970:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb971:
+    mov rax, 7567895004598790407
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 39
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb974
+.Lt.bb973:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb974:
+    mov r12, [rbp-8]
+    imul r12, 39
+    mov rdi, [rbp-8]
+    mov rsi, 39
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb977
+.Lt.bb976:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb977:
+    mov r12, [rbp-8]
+    imul r12, 39
+    mov rdi, [rbp-8]
+    mov rsi, 39
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb980
+.Lt.bb979:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb980:
+    mov rax, 7378697629483820647
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 40
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb983
+.Lt.bb982:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb983:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*4]
+    shl r12, 3
+    mov rdi, [rbp-8]
+    mov rsi, 40
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb986
+.Lt.bb985:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb986:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*4]
+    shl r12, 3
+    mov rdi, [rbp-8]
+    mov rsi, 40
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb989
+.Lt.bb988:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb989:
+    mov rax, 7198729394618361607
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 41
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb992
+.Lt.bb991:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb992:
+    mov r12, [rbp-8]
+    imul r12, 41
+    mov rdi, [rbp-8]
+    mov rsi, 41
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb995
+.Lt.bb994:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb995:
+    mov r12, [rbp-8]
+    imul r12, 41
+    mov rdi, [rbp-8]
+    mov rsi, 41
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb998
+.Lt.bb997:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb998:
+    mov rax, -4392081922311798003
+    imul QWORD PTR [rbp-8]
+    add rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 42
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1001
+.Lt.bb1000:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1001:
+    mov r12, [rbp-8]
+    imul r12, 42
+    mov rdi, [rbp-8]
+    mov rsi, 42
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1004
+.Lt.bb1003:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1004:
+    mov r12, [rbp-8]
+    imul r12, 42
+    mov rdi, [rbp-8]
+    mov rsi, 42
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1007
+.Lt.bb1006:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1007:
+    mov rax, 428994048225803526
+    imul QWORD PTR [rbp-8]
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 43
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1010
+.Lt.bb1009:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1010:
+    mov r12, [rbp-8]
+    imul r12, 43
+    mov rdi, [rbp-8]
+    mov rsi, 43
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1013
+.Lt.bb1012:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1013:
+    mov r12, [rbp-8]
+    imul r12, 43
+    mov rdi, [rbp-8]
+    mov rsi, 43
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1016
+.Lt.bb1015:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1016:
+    mov rax, 3353953467947191203
+    imul QWORD PTR [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 44
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1019
+.Lt.bb1018:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1019:
+    mov r12, [rbp-8]
+    imul r12, 44
+    mov rdi, [rbp-8]
+    mov rsi, 44
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1022
+.Lt.bb1021:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1022:
+    mov r12, [rbp-8]
+    imul r12, 44
+    mov rdi, [rbp-8]
+    mov rsi, 44
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1025
+.Lt.bb1024:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1025:
+    mov rax, 3279421168659475843
+    imul QWORD PTR [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 45
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1028
+.Lt.bb1027:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1028:
+    mov r12, [rbp-8]
+    imul r12, 45
+    mov rdi, [rbp-8]
+    mov rsi, 45
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1031
+.Lt.bb1030:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1031:
+    mov r12, [rbp-8]
+    imul r12, 45
+    mov rdi, [rbp-8]
+    mov rsi, 45
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1034
+.Lt.bb1033:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1034:
+    mov rax, -5614226457215950491
+    imul QWORD PTR [rbp-8]
+    add rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 46
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1037
+.Lt.bb1036:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1037:
+    mov r12, [rbp-8]
+    imul r12, 46
+    mov rdi, [rbp-8]
+    mov rsi, 46
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1040
+.Lt.bb1039:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1040:
+    mov r12, [rbp-8]
+    imul r12, 46
+    mov rdi, [rbp-8]
+    mov rsi, 46
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1043
+.Lt.bb1042:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1043:
+    mov rax, 6279742663390485657
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 47
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1046
+.Lt.bb1045:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1046:
+    mov r12, [rbp-8]
+    imul r12, 47
+    mov rdi, [rbp-8]
+    mov rsi, 47
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1049
+.Lt.bb1048:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1049:
+    mov r12, [rbp-8]
+    imul r12, 47
+    mov rdi, [rbp-8]
+    mov rsi, 47
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1052
+.Lt.bb1051:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1052:
+    mov rax, 3074457345618258603
+    imul QWORD PTR [rbp-8]
+    sar rdx, 3
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 48
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1055
+.Lt.bb1054:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1055:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    shl r12, 4
+    mov rdi, [rbp-8]
+    mov rsi, 48
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1058
+.Lt.bb1057:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1058:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    shl r12, 4
+    mov rdi, [rbp-8]
+    mov rsi, 48
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1061
+.Lt.bb1060:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1061:
+    mov rax, 6023426636313322977
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 49
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1064
+.Lt.bb1063:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1064:
+    mov r12, [rbp-8]
+    imul r12, 49
+    mov rdi, [rbp-8]
+    mov rsi, 49
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1067
+.Lt.bb1066:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1067:
+    mov r12, [rbp-8]
+    imul r12, 49
+    mov rdi, [rbp-8]
+    mov rsi, 49
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1070
+.Lt.bb1069:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1070:
+    mov rax, -6640827866535438581
+    imul QWORD PTR [rbp-8]
+    add rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 50
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1073
+.Lt.bb1072:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1073:
+    mov r12, [rbp-8]
+    imul r12, 50
+    mov rdi, [rbp-8]
+    mov rsi, 50
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1076
+.Lt.bb1075:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1076:
+    mov r12, [rbp-8]
+    imul r12, 50
+    mov rdi, [rbp-8]
+    mov rsi, 50
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1079
+.Lt.bb1078:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1079:
+    mov rax, -6872316419617283935
+    imul QWORD PTR [rbp-8]
+    add rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 51
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1082
+.Lt.bb1081:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1082:
+    mov r12, [rbp-8]
+    imul r12, 51
+    mov rdi, [rbp-8]
+    mov rsi, 51
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1085
+.Lt.bb1084:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1085:
+    mov r12, [rbp-8]
+    imul r12, 51
+    mov rdi, [rbp-8]
+    mov rsi, 51
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1088
+.Lt.bb1087:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1088:
+    mov rax, 5675921253449092805
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 52
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1091
+.Lt.bb1090:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1091:
+    mov r12, [rbp-8]
+    imul r12, 52
+    mov rdi, [rbp-8]
+    mov rsi, 52
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1094
+.Lt.bb1093:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1094:
+    mov r12, [rbp-8]
+    imul r12, 52
+    mov rdi, [rbp-8]
+    mov rsi, 52
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1097
+.Lt.bb1096:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1097:
+    mov rax, 5568828399610430677
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 53
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1100
+.Lt.bb1099:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1100:
+    mov r12, [rbp-8]
+    imul r12, 53
+    mov rdi, [rbp-8]
+    mov rsi, 53
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1103
+.Lt.bb1102:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1103:
+    mov r12, [rbp-8]
+    imul r12, 53
+    mov rdi, [rbp-8]
+    mov rsi, 53
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1106
+.Lt.bb1105:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1106:
+    mov rax, 341606371735362067
+    imul QWORD PTR [rbp-8]
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 54
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1109
+.Lt.bb1108:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1109:
+    mov r12, [rbp-8]
+    imul r12, 54
+    mov rdi, [rbp-8]
+    mov rsi, 54
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1112
+.Lt.bb1111:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1112:
+    mov r12, [rbp-8]
+    imul r12, 54
+    mov rdi, [rbp-8]
+    mov rsi, 54
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1115
+.Lt.bb1114:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1115:
+    mov rax, 5366325548715505925
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 55
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1118
+.Lt.bb1117:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1118:
+    mov r12, [rbp-8]
+    imul r12, 55
+    mov rdi, [rbp-8]
+    mov rsi, 55
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1121
+.Lt.bb1120:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1121:
+    mov r12, [rbp-8]
+    imul r12, 55
+    mov rdi, [rbp-8]
+    mov rsi, 55
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1124
+.Lt.bb1123:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1124:
+    mov rax, 5270498306774157605
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 56
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1127
+.Lt.bb1126:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1127:
+    mov r12, [rbp-8]
+    imul r12, 56
+    mov rdi, [rbp-8]
+    mov rsi, 56
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1130
+.Lt.bb1129:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1130:
+    mov r12, [rbp-8]
+    imul r12, 56
+    mov rdi, [rbp-8]
+    mov rsi, 56
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1133
+.Lt.bb1132:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1133:
+    mov rax, 323627089012448274
+    imul QWORD PTR [rbp-8]
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 57
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1136
+.Lt.bb1135:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1136:
+    mov r12, [rbp-8]
+    imul r12, 57
+    mov rdi, [rbp-8]
+    mov rsi, 57
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1139
+.Lt.bb1138:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1139:
+    mov r12, [rbp-8]
+    imul r12, 57
+    mov rdi, [rbp-8]
+    mov rsi, 57
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1142
+.Lt.bb1141:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1142:
+    mov rax, 5088756985850910791
+    imul QWORD PTR [rbp-8]
+    sar rdx, 4
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 58
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1145
+.Lt.bb1144:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1145:
+    mov r12, [rbp-8]
+    imul r12, 58
+    mov rdi, [rbp-8]
+    mov rsi, 58
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1148
+.Lt.bb1147:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1148:
+    mov r12, [rbp-8]
+    imul r12, 58
+    mov rdi, [rbp-8]
+    mov rsi, 58
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1151
+.Lt.bb1150:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1151:
+    mov rax, -8441730338816235485
+    imul QWORD PTR [rbp-8]
+    add rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 59
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1154
+.Lt.bb1153:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1154:
+    mov r12, [rbp-8]
+    imul r12, 59
+    mov rdi, [rbp-8]
+    mov rsi, 59
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1157
+.Lt.bb1156:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1157:
+    mov r12, [rbp-8]
+    imul r12, 59
+    mov rdi, [rbp-8]
+    mov rsi, 59
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1160
+.Lt.bb1159:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1160:
+    mov rax, -8608480567731124087
+    imul QWORD PTR [rbp-8]
+    add rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 60
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1163
+.Lt.bb1162:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1163:
+    mov r12, [rbp-8]
+    imul r12, 60
+    mov rdi, [rbp-8]
+    mov rsi, 60
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1166
+.Lt.bb1165:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1166:
+    mov r12, [rbp-8]
+    imul r12, 60
+    mov rdi, [rbp-8]
+    mov rsi, 60
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1169
+.Lt.bb1168:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1169:
+    mov rax, -8769763576025852407
+    imul QWORD PTR [rbp-8]
+    add rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 61
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1172
+.Lt.bb1171:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1172:
+    mov r12, [rbp-8]
+    imul r12, 61
+    mov rdi, [rbp-8]
+    mov rsi, 61
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1175
+.Lt.bb1174:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1175:
+    mov r12, [rbp-8]
+    imul r12, 61
+    mov rdi, [rbp-8]
+    mov rsi, 61
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1178
+.Lt.bb1177:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1178:
+    mov rax, -8925843906633654007
+    imul QWORD PTR [rbp-8]
+    add rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 62
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1181
+.Lt.bb1180:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1181:
+    mov r12, [rbp-8]
+    imul r12, 62
+    mov rdi, [rbp-8]
+    mov rsi, 62
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1184
+.Lt.bb1183:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1184:
+    mov r12, [rbp-8]
+    imul r12, 62
+    mov rdi, [rbp-8]
+    mov rsi, 62
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1187
+.Lt.bb1186:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1187:
+    mov rax, -9076969306111049207
+    imul QWORD PTR [rbp-8]
+    add rdx, [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 63
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1190
+.Lt.bb1189:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1190:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 6
+    sub r12, rdi
+    mov rdi, [rbp-8]
+    mov rsi, 63
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1193
+.Lt.bb1192:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1193:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 6
+    sub r12, rdi
+    mov rdi, [rbp-8]
+    mov rsi, 63
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1196
+.Lt.bb1195:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1196:
+    mov rax, [rbp-8]
+    cqo
+    shr rdx, 58
+    add rax, rdx
+    sar rax, 6
+    mov r12, rax
+    mov rdi, [rbp-8]
+    mov rsi, 64
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1199
+.Lt.bb1198:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1199:
+    mov r12, [rbp-8]
+    shl r12, 6
+    mov rdi, [rbp-8]
+    mov rsi, 64
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1202
+.Lt.bb1201:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1202:
+    mov r12, [rbp-8]
+    shl r12, 6
+    mov rdi, [rbp-8]
+    mov rsi, 64
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1205
+.Lt.bb1204:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1205:
+    mov rax, 1135184250689818561
+    imul QWORD PTR [rbp-8]
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 65
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1208
+.Lt.bb1207:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1208:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 6
+    add r12, rdi
+    mov rdi, [rbp-8]
+    mov rsi, 65
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1211
+.Lt.bb1210:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1211:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 6
+    add r12, rdi
+    mov rdi, [rbp-8]
+    mov rsi, 65
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1214
+.Lt.bb1213:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1214:
+    mov rax, 1117984489315730401
+    imul QWORD PTR [rbp-8]
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 66
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1217
+.Lt.bb1216:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1217:
+    mov r12, [rbp-8]
+    imul r12, 66
+    mov rdi, [rbp-8]
+    mov rsi, 66
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1220
+.Lt.bb1219:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1220:
+    mov r12, [rbp-8]
+    imul r12, 66
+    mov rdi, [rbp-8]
+    mov rsi, 66
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1223
+.Lt.bb1222:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1223:
+    mov rax, 8810385229234412713
+    imul QWORD PTR [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 67
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1226
+.Lt.bb1225:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1226:
+    mov r12, [rbp-8]
+    imul r12, 67
+    mov rdi, [rbp-8]
+    mov rsi, 67
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1229
+.Lt.bb1228:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1229:
+    mov r12, [rbp-8]
+    imul r12, 67
+    mov rdi, [rbp-8]
+    mov rsi, 67
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1232
+.Lt.bb1231:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1232:
+    mov rax, 8680820740569200761
+    imul QWORD PTR [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 68
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1235
+.Lt.bb1234:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1235:
+    mov r12, [rbp-8]
+    imul r12, 68
+    mov rdi, [rbp-8]
+    mov rsi, 68
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1238
+.Lt.bb1237:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1238:
+    mov r12, [rbp-8]
+    imul r12, 68
+    mov rdi, [rbp-8]
+    mov rsi, 68
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1241
+.Lt.bb1240:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1241:
+    mov rax, 8555011744329067417
+    imul QWORD PTR [rbp-8]
+    sar rdx, 5
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 69
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1244
+.Lt.bb1243:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1244:
+    mov r12, [rbp-8]
+    imul r12, 69
+    mov rdi, [rbp-8]
+    mov rsi, 69
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1247
+.Lt.bb1246:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1247:
+    mov r12, [rbp-8]
+    imul r12, 69
+    mov rdi, [rbp-8]
+    mov rsi, 69
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1250
+.Lt.bb1249:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1250:
+    mov rax, 1054099661354831521
+    imul QWORD PTR [rbp-8]
+    sar rdx, 2
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 70
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1253
+.Lt.bb1252:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1253:
+    mov r12, [rbp-8]
+    imul r12, 70
+    mov rdi, [rbp-8]
+    mov rsi, 70
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1256
+.Lt.bb1255:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1256:
+    mov r12, [rbp-8]
+    imul r12, 70
+    mov rdi, [rbp-8]
+    mov rsi, 70
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1259
+.Lt.bb1258:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1259:
+    mov rax, -6640827866535438581
+    imul QWORD PTR [rbp-8]
+    add rdx, [rbp-8]
+    sar rdx, 6
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 100
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1262
+.Lt.bb1261:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1262:
+    mov r12, [rbp-8]
+    imul r12, 100
+    mov rdi, [rbp-8]
+    mov rsi, 100
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1265
+.Lt.bb1264:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1265:
+    mov r12, [rbp-8]
+    imul r12, 100
+    mov rdi, [rbp-8]
+    mov rsi, 100
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1268
+.Lt.bb1267:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1268:
+    mov rax, 7367186400732675841
+    imul QWORD PTR [rbp-8]
+    sar rdx, 8
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 641
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1271
+.Lt.bb1270:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1271:
+    mov r12, [rbp-8]
+    imul r12, 641
+    mov rdi, [rbp-8]
+    mov rsi, 641
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1274
+.Lt.bb1273:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1274:
+    mov r12, [rbp-8]
+    imul r12, 641
+    mov rdi, [rbp-8]
+    mov rsi, 641
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1277
+.Lt.bb1276:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1277:
+    mov rax, 2361183241434822607
+    imul QWORD PTR [rbp-8]
+    sar rdx, 7
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 1000
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1280
+.Lt.bb1279:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1280:
+    mov r12, [rbp-8]
+    imul r12, 1000
+    mov rdi, [rbp-8]
+    mov rsi, 1000
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1283
+.Lt.bb1282:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1283:
+    mov r12, [rbp-8]
+    imul r12, 1000
+    mov rdi, [rbp-8]
+    mov rsi, 1000
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1286
+.Lt.bb1285:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1286:
+    mov rax, 6120523590596543007
+    imul QWORD PTR [rbp-8]
+    sar rdx, 12
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 12345
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1289
+.Lt.bb1288:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1289:
+    mov r12, [rbp-8]
+    imul r12, 12345
+    mov rdi, [rbp-8]
+    mov rsi, 12345
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1292
+.Lt.bb1291:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1292:
+    mov r12, [rbp-8]
+    imul r12, 12345
+    mov rdi, [rbp-8]
+    mov rsi, 12345
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1295
+.Lt.bb1294:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1295:
+    mov rax, -9223372032559808509
+    imul QWORD PTR [rbp-8]
+    add rdx, [rbp-8]
+    sar rdx, 30
+    mov rax, rdx
+    shr rax, 63
+    add rdx, rax
+    mov r12, rdx
+    mov rdi, [rbp-8]
+    mov rsi, 2147483647
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1298
+.Lt.bb1297:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1298:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 31
+    sub r12, rdi
+    mov rdi, [rbp-8]
+    mov rsi, 2147483647
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1301
+.Lt.bb1300:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1301:
+    mov rdi, [rbp-8]
+    mov r12, rdi
+    shl r12, 31
+    sub r12, rdi
+    mov rdi, [rbp-8]
+    mov rsi, 2147483647
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1304
+.Lt.bb1303:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1304:
+    mov rax, [rbp-8]
+    cqo
+    shr rdx, 33
+    add rax, rdx
+    sar rax, 31
+    neg rax
+    mov r12, rax
+    mov rdi, [rbp-8]
+    mov rsi, -2147483648
+    call dv
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1307
+.Lt.bb1306:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1307:
+    mov r12, [rbp-8]
+    shl r12, 31
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -2147483648
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1310
+.Lt.bb1309:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1310:
+    mov r12, [rbp-8]
+    shl r12, 31
+    neg r12
+    mov rdi, [rbp-8]
+    mov rsi, -2147483648
+    call ml
+    mov r13, rax
+    cmp r12, r13
+    je .Lt.bb1313
+.Lt.bb1312:
+    mov rax, 1
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lt.bb1313:
+    mov rax, 0
+    pop r13
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.globl main
+main:
+    push rbp
+    mov rbp, rsp
+    sub rsp, 40
+    push r12
+    mov QWORD PTR [rbp-8], 1
+    mov QWORD PTR [rbp-16], 0
+.Lmain.bb1:
+    cmp QWORD PTR [rbp-16], 45
+    jge .Lmain.bb3
+.Lmain.bb2:
+    mov rdi, [rbp-8]
+    call t
+    mov r12, rax
+    cmp r12, 0
+    je .Lmain.bb5
+    jmp .Lmain.bb4
+.Lmain.bb3:
+    mov rax, 0
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lmain.bb4:
+    mov rax, 1
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lmain.bb5:
+    mov r12, 0
+    sub r12, [rbp-8]
+    mov rdi, r12
+    call t
+    mov r12, rax
+    cmp r12, 0
+    je .Lmain.bb8
+.Lmain.bb7:
+    mov rax, 2
+    pop r12
+    mov rsp, rbp
+    pop rbp
+    ret
+.Lmain.bb8:
+    mov r12, [rbp-8]
+    lea r12, [r12+r12*2]
+    add r12, 1
+    mov [rbp-8], r12
+    mov r12, [rbp-16]
+    add r12, 1
+    mov [rbp-16], r12
+    jmp .Lmain.bb1
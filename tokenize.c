@@ -3,198 +3,380 @@
 
 #include "9cc.h"
 
-// トークン列
-Token *token;
+#include <pthread.h>
+#include <stdatomic.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// エラーのメッセージを文脈に記録してerror_jmpへ戻る
+// locがNULLでなければ，locを含む行とエラー箇所の印をメッセージの前に置く
+// 入力に名前があれば"名前:行番号: "を行の前に(locがNULLなら"名前: "をメッセージの前に)付ける
+// コード生成のスレッドが同時にエラーになることがあるので，最初のものだけを残す
+static void report(char *loc, char *fmt, va_list ap) {
+	if (!atomic_exchange(&ctx->failed, true)) {
+		char *line = loc, *line_end = loc;
+		int line_no = 1, prefix = 0;
+		if (loc) {
+			char *start = ctx->user_input, *end = start + ctx->input_len;
+			while (line > start && line[-1] != '\n') {
+				line--;
+			}
+			while (line_end < end && *line_end != '\n') {
+				line_end++;
+			}
+			for (char *p = start; (p = memchr(p, '\n', line - p)); p++) {
+				line_no++;
+			}
+			if (ctx->input_name) {
+				prefix = snprintf(NULL, 0, "%s:%d: ", ctx->input_name, line_no);
+			}
+		}
+		else if (ctx->input_name) {
+			prefix = strlen(ctx->input_name) + 2;
+		}
+		int pos = loc ? prefix + (loc - line) : 0;
+		size_t head = loc ? prefix + (line_end - line) + 1 + (pos > 0 ? pos : 1) + 2 : prefix;
+		va_list aq;
+		va_copy(aq, ap);
+		int len = vsnprintf(NULL, 0, fmt, aq);
+		va_end(aq);
+
+		// 確保できなければメッセージなしで失敗する
+		char *msg = malloc(head + len + 1);
+		if (msg) {
+			char *p = msg;
+			if (loc) {
+				if (ctx->input_name) {
+					p += sprintf(p, "%s:%d: ", ctx->input_name, line_no);
+				}
+				memcpy(p, line, line_end - line);
+				p += line_end - line;
+				*p++ = '\n';
+				p += sprintf(p, "%*s^ ", pos, " ");
+			}
+			else if (ctx->input_name) {
+				p += sprintf(p, "%s: ", ctx->input_name);
+			}
+			vsprintf(p, fmt, ap);
+		}
+		ctx->error_msg = msg;
+	}
+
+	if (!error_jmp) {
+		// compileの外で呼ばれたとき
+		fprintf(stderr, "%s\n", ctx->error_msg ? ctx->error_msg : "");
+		exit(1);
+	}
+	longjmp(*error_jmp, 1);
+}
 
 void error(char *fmt, ...) {
 	va_list ap;
 	va_start(ap, fmt);
-	vfprintf(stderr, fmt, ap);
-	fprintf(stderr, "\n");
-	exit(1);
+	report(NULL, fmt, ap);
+	va_end(ap);
 }
 
-// 入力
-char *user_input;
-
 // エラー箇所報告
 void error_at(char *loc, char *fmt, ...) {
 	va_list ap;
 	va_start(ap, fmt);
-
-	int pos = loc - user_input;
-	fprintf(stderr, "%s\n", user_input);
-	fprintf(stderr, "%*s", pos, " ");
-	fprintf(stderr, "^ ");
-	vfprintf(stderr, fmt, ap);
-	fprintf(stderr, "\n");
-	exit(1);
+	report(loc, fmt, ap);
+	va_end(ap);
 }
 
 // トークンを読み進める
 // 期待している記号なら真，そうでなければ偽
 bool consume(char *op) {
-	if (token->kind != TK_RESERVED || strlen(op) != token->len
-		|| memcmp(token->str, op, token->len)) {
-		//printf("token is not \"%s\"\n", op);
+	Token *tok = &ctx->tokens[ctx->token_pos];
+	if (tok->kind != TK_RESERVED || strlen(op) != tok->len
+		|| memcmp(tok->str, op, tok->len)) {
 		return false;
 	}
-	token = token->next;
+	ctx->token_pos++;
 	return true;
 }
 
 // トークンを読み進める
 // 期待している記号なら読み進めるだけで，そうでなければエラーを報告
 void expect(char *op) {
-if (token->kind != TK_RESERVED || strlen(op) != token->len
-	|| memcmp(token->str, op, token->len)) {
-		error_at(token->str, "\"%s\"ではありません", op);
+	Token *tok = &ctx->tokens[ctx->token_pos];
+	if (tok->kind != TK_RESERVED || strlen(op) != tok->len
+		|| memcmp(tok->str, op, tok->len)) {
+		error_at(tok->str, "\"%s\"ではありません", op);
 	}
-	token = token->next;
+	ctx->token_pos++;
 }
 
 // 次のトークンが数値である場合，トークンを読み進めてその値を返す．
 // 数値でない場合，エラーを報告する．
 int expect_number() {
-	if (token->kind != TK_NUM) {
-		error_at(token->str, "数ではありません");
+	Token *tok = &ctx->tokens[ctx->token_pos];
+	if (tok->kind != TK_NUM) {
+		error_at(tok->str, "数ではありません");
 	}
-	int val = token->val;
-	token = token->next;
-	return val;
+	ctx->token_pos++;
+	return tok->val;
 }
 
 // 引数のトークン種類と一致するトークンかどうか調べる
 // 一致すればそれを返し読み進め，しなければNULLを返す
 Token *consume_token(TokenKind kind) {
-	if (token->kind != kind) {
+	Token *tok = &ctx->tokens[ctx->token_pos];
+	if (tok->kind != kind) {
 		return NULL;
 	}
-	Token *tok = token;
-	token = token->next;
+	ctx->token_pos++;
 	return tok;
 }
 
 // 入力の終わりかどうかを調べる
 bool at_eof() {
-	return token->kind == TK_EOF;
+	return ctx->tokens[ctx->token_pos].kind == TK_EOF;
 }
 
-// 新しいトークンを生成してcurに繋げる
-Token *new_token(TokenKind kind, Token *cur, char *str, int len) {
-	Token *tok = calloc(1, sizeof(Token));
+// 新しいトークンを配列の末尾に追加する
+// 返すポインタは次のnew_tokenまで有効
+Token *new_token(TokenKind kind, char *str, int len) {
+	if (ctx->tokens_len == ctx->tokens_cap) {
+		ctx->tokens_cap = ctx->tokens_cap ? ctx->tokens_cap * 2 : 1024;
+		ctx->tokens = realloc(ctx->tokens, sizeof(Token) * ctx->tokens_cap);
+		if (!ctx->tokens) {
+			error("メモリが足りません");
+		}
+		ctx->token_allocs++;
+	}
+	if (len >= TOKEN_MAX_LEN) {
+		error_at(str, "トークンが長すぎます");
+	}
+
+	Token *tok = &ctx->tokens[ctx->tokens_len++];
 	tok->kind = kind;
 	tok->str = str;
 	tok->len = len;
-	cur->next = tok;
+	tok->val = 0;
 	return tok;
 }
 
+// 文字クラス
+// 1文字目で字句の種類が決まるので，表引き1回で分岐する
+enum {
+	CC_OTHER,	// トークナイズできない文字
+	CC_SPACE,	// 空白文字
+	CC_DIGIT,	// 数字
+	CC_IDENT,	// 識別子の先頭になれる文字
+	CC_PUNCT,	// 1文字の記号
+	CC_PUNCT2,	// 後ろに'='が続くと2文字の記号になる文字
+};
+
+static unsigned char char_class[256];
+
+// 識別子の2文字目以降に使える文字なら真
+static bool is_ident_char[256];
+
 // 英数字またはアンダースコアかどうかを判定する
 // そうなら正の値，それ以外なら0を返す
 int is_alnum(char c) {
-	return ('a' <= c && c <= 'z') ||
-		   ('A' <= c && c <= 'Z') ||
-		   ('0' <= c && c <= '9') ||
-		   (c == '_');
+	return is_ident_char[(unsigned char)c];
 }
 
-char *keywords[] = {
-	"return", "if", "else", "while", "for", "int", 
-	NULL
+typedef struct {
+	char *name;
+	TokenKind kind;
+} Keyword;
+
+Keyword keywords[] = {
+	{"return", TK_RETURN}, {"if", TK_IF}, {"else", TK_ELSE},
+	{"while", TK_WHILE}, {"for", TK_FOR}, {"int", TK_INTTYPE},
+	{NULL, 0},
 };
 
-// トークナイズする
-// headというダミーの要素を用いる，headの次の要素を返す
-void tokenize(char *p) {
-	Token head;
-	head.next = NULL;
-	Token *cur = &head;
-
-	while (*p) {
-		// 空白文字
-		if (isspace(*p)) {
-			p++;
-			continue;
-		}
+// キーワードの完全ハッシュ表
+// keywords[]から衝突しない係数を起動時に探して作る
+#define KW_TABLE_SIZE 32
 
-		// 長さ2の記号
-		if (strncmp(p, "==", 2) == 0 || strncmp(p, "!=", 2) == 0
-			|| strncmp(p, "<=", 2) == 0 || strncmp(p, ">=", 2) == 0) {
-			cur = new_token(TK_RESERVED, cur, p, 2);
-			p += 2;
-			continue;
-		}
+static Keyword *kw_table[KW_TABLE_SIZE];
+static unsigned kw_mul1, kw_mul2;
 
-		// 長さ1の記号
-		if (strchr("+-*/()<>=;{},&", *p)) {
-			cur = new_token(TK_RESERVED, cur, p++, 1);
-			continue;
-		}
+static unsigned kw_hash(char *s, int len) {
+	unsigned char first = s[0], last = s[len - 1];
+	return (first * kw_mul1 + last * kw_mul2 + len) % KW_TABLE_SIZE;
+}
 
-		// number
-		if (isdigit(*p)) {
-			cur = new_token(TK_NUM, cur, p, 0);
-			char *q = p;
-			cur->val = strtol(p, &p, 10);
-			cur->len = p - q;
-			continue;
+static void init_keywords() {
+	for (kw_mul1 = 1; kw_mul1 < 64; kw_mul1++) {
+		for (kw_mul2 = 1; kw_mul2 < 64; kw_mul2++) {
+			memset(kw_table, 0, sizeof(kw_table));
+			bool ok = true;
+			for (Keyword *kw = keywords; kw->name && ok; kw++) {
+				unsigned h = kw_hash(kw->name, strlen(kw->name));
+				if (kw_table[h]) {
+					ok = false;
+				}
+				kw_table[h] = kw;
+			}
+			if (ok) {
+				return;
+			}
 		}
+	}
+	error("キーワードの完全ハッシュを作れません");
+}
 
-		// return
-		if (strncmp(p, "return", 6) == 0 && !is_alnum(*(p + 6))) {
-			cur = new_token(TK_RETURN, cur, p, 6);
-			p += 6;
-			continue;
-		}
+// 識別子がキーワードならその種類を，そうでなければTK_IDENTを返す
+static TokenKind lookup_keyword(char *s, int len) {
+	Keyword *kw = kw_table[kw_hash(s, len)];
+	if (kw && strlen(kw->name) == len && !memcmp(kw->name, s, len)) {
+		return kw->kind;
+	}
+	return TK_IDENT;
+}
 
-		// if
-		if (strncmp(p, "if", 2) == 0 && !is_alnum(*(p + 2))) {
-			cur = new_token(TK_IF, cur, p, 2);
-			p += 2;
-			continue;
-		}
+// 表は全スレッドで共有するので，最初の1回だけ作る
+static pthread_once_t char_class_once = PTHREAD_ONCE_INIT;
 
-		// else
-		if (strncmp(p, "else", 4) == 0 && !is_alnum(*(p + 4))) {
-			cur = new_token(TK_ELSE, cur, p, 4);
-			p += 4;
-			continue;
+static void init_char_class() {
+	for (int c = 0; c < 256; c++) {
+		if (isspace(c)) {
+			char_class[c] = CC_SPACE;
 		}
+		else if (isdigit(c)) {
+			char_class[c] = CC_DIGIT;
+		}
+		else if (isalpha(c) || c == '_') {
+			char_class[c] = CC_IDENT;
+		}
+		is_ident_char[c] = isalnum(c) || c == '_';
+	}
+	for (char *s = "+-*/()=;{},&<>"; *s; s++) {
+		char_class[(unsigned char)*s] = CC_PUNCT;
+	}
+	for (char *s = "=!<>"; *s; s++) {
+		char_class[(unsigned char)*s] = CC_PUNCT2;
+	}
+	init_keywords();
+}
 
-		// while
-		if (strncmp(p, "while", 5) == 0 && !is_alnum(*(p + 5))) {
-			cur = new_token(TK_WHILE, cur, p, 5);
-			p += 5;
-			continue;
+// 空白文字の並びを読み飛ばす
+// 16バイト(AVX2なら32バイト)ずつまとめて判定する
+static char *skip_space(char *p, char *end) {
+#if defined(__AVX2__)
+	while (end - p >= 32) {
+		__m256i v = _mm256_loadu_si256((__m256i *)p);
+		__m256i sp = _mm256_cmpeq_epi8(v, _mm256_set1_epi8(' '));
+		__m256i ctl = _mm256_and_si256(_mm256_cmpgt_epi8(v, _mm256_set1_epi8('\t' - 1)),
+		                               _mm256_cmpgt_epi8(_mm256_set1_epi8('\r' + 1), v));
+		unsigned m = _mm256_movemask_epi8(_mm256_or_si256(sp, ctl));
+		if (m != 0xffffffff) {
+			return p + __builtin_ctz(~m);
+		}
+		p += 32;
+	}
+#endif
+#if defined(__SSE2__)
+	while (end - p >= 16) {
+		__m128i v = _mm_loadu_si128((__m128i *)p);
+		__m128i sp = _mm_cmpeq_epi8(v, _mm_set1_epi8(' '));
+		__m128i ctl = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('\t' - 1)),
+		                            _mm_cmplt_epi8(v, _mm_set1_epi8('\r' + 1)));
+		unsigned m = _mm_movemask_epi8(_mm_or_si128(sp, ctl));
+		if (m != 0xffff) {
+			return p + __builtin_ctz(~m & 0xffff);
 		}
+		p += 16;
+	}
+#endif
+	while (p < end && char_class[(unsigned char)*p] == CC_SPACE) {
+		p++;
+	}
+	return p;
+}
 
-		// for
-		if (strncmp(p, "for", 3) == 0 && !is_alnum(*(p + 3))) {
-			cur = new_token(TK_FOR, cur, p, 3);
-			p += 3;
-			continue;
+// 識別子に使える文字の並びを読み飛ばす
+static char *skip_ident(char *p, char *end) {
+#if defined(__SSE2__)
+	while (end - p >= 16) {
+		__m128i v = _mm_loadu_si128((__m128i *)p);
+		// 0x20を立てると英大文字が小文字に重なる
+		__m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+		__m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+		                              _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+		__m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+		                              _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+		__m128i under = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+		unsigned m = _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(alpha, digit), under));
+		if (m != 0xffff) {
+			return p + __builtin_ctz(~m & 0xffff);
 		}
+		p += 16;
+	}
+#endif
+	while (p < end && is_ident_char[(unsigned char)*p]) {
+		p++;
+	}
+	return p;
+}
+
+// pからlenバイトをトークナイズする
+// 結果はctx->tokens[0..tokens_len)に格納され，末尾はTK_EOF
+void tokenize(char *p, size_t len) {
+	pthread_once(&char_class_once, init_char_class);
+
+	ctx->user_input = p;
+	ctx->input_len = len;
+	ctx->tokens_len = 0;
+	ctx->token_pos = 0;
+	char *end = p + len;
 
-		if (strncmp(p, "int", 3) == 0 && !is_alnum(*(p + 3))) {
-			cur = new_token(TK_INTTYPE, cur, p, 3);
-			p += 3;
+	while (p < end) {
+		switch (char_class[(unsigned char)*p]) {
+		case CC_SPACE:
+			p = skip_space(p + 1, end);
+			continue;
+		case CC_PUNCT2:
+			// 長さ2の記号
+			if (p + 1 < end && p[1] == '=') {
+				new_token(TK_RESERVED, p, 2);
+				p += 2;
+				continue;
+			}
+			if (*p == '!') {
+				break;
+			}
+			// fallthrough
+		case CC_PUNCT:
+			// 長さ1の記号
+			new_token(TK_RESERVED, p++, 1);
+			continue;
+		case CC_DIGIT: {
+			// number
+			char *q = p;
+			int64_t val = 0;
+			while (p < end && char_class[(unsigned char)*p] == CC_DIGIT) {
+				val = val * 10 + (*p++ - '0');
+				if (val > INT32_MAX) {
+					error_at(q, "数が大きすぎます");
+				}
+			}
+			new_token(TK_NUM, q, p - q)->val = val;
 			continue;
 		}
-
-		// identifier
-		if (isalpha(*p) || *p == '_') {
+		case CC_IDENT: {
+			// キーワードまたは識別子
 			char *start = p;
-			while (isalnum(*p)) {
-				p++;
-			}
-			cur = new_token(TK_IDENT, cur, start, p - start);
+			p = skip_ident(p + 1, end);
+			int len = p - start;
+			new_token(lookup_keyword(start, len), start, len);
 			continue;
 		}
+		}
 
-		error_at(token->str, "tokenizeできません");
+		error_at(p, "tokenizeできません");
 	}
 
-	new_token(TK_EOF, cur, p, 0);
-	token = head.next;
+	new_token(TK_EOF, p, 0);
 }